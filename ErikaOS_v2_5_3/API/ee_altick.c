@@ -86,7 +86,7 @@ static EE_TYPETICK EE_ORTI_alarmtime[EE_MAX_ALARM
 #ifdef EE_KEEP_ALARM_QUEUE_CODE
 /* Increment equal to 0 means next tick. Has been used this convention to
    utilize all values from zero to counter.maxallowedvalue range */
-void EE_oo_counter_object_insert( CounterObjectType ObjectID,
+EE_COMPILER_RAMFUNC void EE_oo_counter_object_insert( CounterObjectType ObjectID,
   TickType increment )
 {
   register CounterObjectType  current, previous;
@@ -136,7 +136,7 @@ void EE_oo_counter_object_insert( CounterObjectType ObjectID,
 
 static void EE_oo_handle_action_task(EE_oo_action_ROM_type const * const p_action);
 
-static void EE_oo_handle_action_task(EE_oo_action_ROM_type const * const
+static EE_COMPILER_RAMFUNC void EE_oo_handle_action_task(EE_oo_action_ROM_type const * const
   p_action)
 {
   /* Error Value */
@@ -213,7 +213,7 @@ static void EE_oo_handle_action_task(EE_oo_action_ROM_type const * const
 #if (defined(__OO_ECC1__)) || (defined(__OO_ECC2__))
 static void EE_oo_handle_action_event(EE_oo_action_ROM_type const * const p_action);
   
-static void EE_oo_handle_action_event(EE_oo_action_ROM_type const * const
+static EE_COMPILER_RAMFUNC void EE_oo_handle_action_event(EE_oo_action_ROM_type const * const
   p_action)
 {
   /* Error Value */
@@ -339,7 +339,7 @@ static void EE_oo_handle_action_callback ( const EE_oo_action_ROM_type *
 
 static void EE_oo_handle_action(EE_oo_action_ROM_type const * const p_action);
 
-static void EE_oo_handle_action(EE_oo_action_ROM_type const * const p_action)
+static EE_COMPILER_RAMFUNC void EE_oo_handle_action(EE_oo_action_ROM_type const * const p_action)
 {
   if ( p_action != NULL ) {
     
@@ -541,7 +541,7 @@ static void  EE_as_handle_schedule_table( ScheduleTableType STId )
 #endif /* EE_MAX_SCHEDULETABLE > 0 */
 #endif /* EE_AS_SCHEDULETABLES__ */
 
-void EE_oo_IncrementCounterImplementation(CounterType CounterID)
+EE_COMPILER_RAMFUNC void EE_oo_IncrementCounterImplementation(CounterType CounterID)
 {
   /* to_fire: Is the head of the splitted queue that have to be served at this
               counter tick. */
@@ -698,7 +698,7 @@ StatusType EE_oo_IncrementCounterHardware(CounterType CounterID)
 
 #ifndef __PRIVATE_INCREMENTCOUNTER__
 /* [OS399]: IncrementCounter */
-StatusType EE_oo_IncrementCounter(CounterType CounterID)
+EE_COMPILER_RAMFUNC StatusType EE_oo_IncrementCounter(CounterType CounterID)
 {
   /* Error Value */
   register StatusType ev;
@@ -745,6 +745,10 @@ StatusType EE_oo_IncrementCounter(CounterType CounterID)
 #if (EE_SOFT_COUNTERS_START > 0)
     (CounterID < (CounterType)EE_SOFT_COUNTERS_START) ||
 #endif /* (EE_SOFT_COUNTERS_START > 0) */
+#ifdef EE_HR_COUNTER__
+    /* The high resolution counter follows its timer (HrCounterTick) */
+    (CounterID == EE_HR_COUNTER) ||
+#endif /* EE_HR_COUNTER__ */
     (CounterID >= EE_MAX_COUNTER) )
   {
     ev = E_OS_ID;
@@ -0,0 +1,215 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+ /** @file      ee_as_exec_budget.c
+  *  @brief     Execution budget monitoring, reached through the timing
+  *             protection call sites (see ee_as_timing_prot.inc).
+  */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "`$INSTANCE_NAME`_ee_internal.inc"
+
+#ifdef EE_EXECUTION_BUDGET__
+
+/* Budget statistics of every TASK */
+EE_as_eb_RAM_type EE_as_eb_RAM[EE_MAX_TASK];
+
+/* TASK whose job is charged, EE_NIL while idle or paused */
+static TaskType   EE_as_eb_active = EE_NIL;
+/* Start of the running, not yet charged, slice of EE_as_eb_active */
+static EE_UINT32  EE_as_eb_last_update;
+
+/* Inter-arrival clock: cycles at EE_CPU_CLOCK at the last divider change,
+   the DWT counter at that change and the current divider */
+static EE_UINT32  EE_as_eb_arrival_base;
+static EE_UINT32  EE_as_eb_arrival_dwt;
+static EE_UINT32  EE_as_eb_divider = 1U;
+
+/* Time at EE_CPU_CLOCK, modulo 2^32 the product is exact across DWT wraps */
+static EE_UINT32 EE_as_eb_arrival_now ( void )
+{
+  return EE_as_eb_arrival_base +
+    ((EE_cortex_mx_dwt_cycles() - EE_as_eb_arrival_dwt) * EE_as_eb_divider);
+}
+
+/* Charge the slice of the active job and count an overrun once per job */
+static void EE_as_eb_charge ( EE_UINT32 now )
+{
+  if ( EE_as_eb_active != EE_NIL ) {
+    register EE_as_eb_RAM_type * const p_RAM =
+      &EE_as_eb_RAM[EE_as_eb_active];
+    register EE_UINT32 const budget = EE_as_eb_ROM[EE_as_eb_active].budget;
+
+    p_RAM->job_cycles += now - EE_as_eb_last_update;
+
+    if ( (budget != 0U) && (p_RAM->job_cycles > budget) &&
+      (p_RAM->job_overrun == EE_FALSE) )
+    {
+      p_RAM->job_overrun = EE_TRUE;
+      ++p_RAM->overruns;
+    }
+  }
+  EE_as_eb_last_update = now;
+}
+
+void EE_as_eb_init ( void )
+{
+  /* Budget clock: DWT cycle counter */
+  EE_cortex_mx_dwt_start();
+  EE_as_eb_last_update = EE_cortex_mx_dwt_cycles();
+  EE_as_eb_arrival_dwt = EE_as_eb_last_update;
+}
+
+void EE_as_eb_job_start ( TaskType task_id )
+{
+  EE_as_eb_RAM[task_id].job_cycles  = 0U;
+  EE_as_eb_RAM[task_id].job_overrun = EE_FALSE;
+  EE_as_eb_active       = task_id;
+  EE_as_eb_last_update  = EE_cortex_mx_dwt_cycles();
+}
+
+void EE_as_eb_resume ( TaskType task_id )
+{
+  EE_as_eb_active       = task_id;
+  EE_as_eb_last_update  = EE_cortex_mx_dwt_cycles();
+}
+
+void EE_as_eb_job_end ( void )
+{
+  /* The end of an ISR2 does not end the job of the TASK it interrupted */
+  if ( (EE_hal_get_IRQ_nesting_level() == 0U) &&
+    (EE_as_eb_active != EE_NIL) )
+  {
+    register EE_as_eb_RAM_type * const p_RAM =
+      &EE_as_eb_RAM[EE_as_eb_active];
+
+    /* The service that ends the job has already paused the accounting */
+    if ( p_RAM->job_cycles > p_RAM->max_cycles ) {
+      p_RAM->max_cycles = p_RAM->job_cycles;
+    }
+    ++p_RAM->jobs;
+    EE_as_eb_active = EE_NIL;
+  }
+}
+
+void EE_as_eb_pause ( void )
+{
+  /* ISR2 time is not charged: the prologue of the outermost ISR2 already
+     paused the job and kernel services called by ISR2s must not charge it */
+  if ( EE_hal_get_IRQ_nesting_level() == 0U ) {
+    EE_as_eb_charge(EE_cortex_mx_dwt_cycles());
+  }
+}
+
+void EE_as_eb_restart ( void )
+{
+  if ( EE_hal_get_IRQ_nesting_level() == 0U ) {
+    EE_as_eb_last_update = EE_cortex_mx_dwt_cycles();
+  }
+}
+
+EE_TYPEBOOL EE_as_eb_handle_interarrival ( TaskType task_id )
+{
+  register EE_as_eb_RAM_type * const p_RAM = &EE_as_eb_RAM[task_id];
+  register EE_UINT32 const min_interarrival =
+    EE_as_eb_ROM[task_id].min_interarrival;
+  register EE_UINT32 const now = EE_as_eb_arrival_now();
+
+  if ( (min_interarrival != 0U) && (p_RAM->arrived != EE_FALSE) &&
+    ((now - p_RAM->last_arrival) < min_interarrival) )
+  {
+    ++p_RAM->arrival_violations;
+  }
+  p_RAM->last_arrival = now;
+  p_RAM->arrived      = EE_TRUE;
+
+  return EE_TRUE;
+}
+
+#ifndef __PRIVATE_GETEXECUTIONBUDGETSTATS__
+StatusType EE_as_GetExecutionBudgetStats ( TaskType TaskID,
+  EE_as_eb_RAM_type * Stats )
+{
+  /* Error Value */
+  register StatusType ev;
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+#ifdef __OO_EXTENDED_STATUS__
+  if ( (TaskID < 0) || (TaskID >= EE_MAX_TASK) ) {
+    ev = E_OS_ID;
+  } else if ( Stats == NULL ) {
+    ev = E_OS_PARAM_POINTER;
+  } else
+#endif /* __OO_EXTENDED_STATUS__ */
+  {
+    /* Consistent copy: the job of the caller is paused here */
+    *Stats = EE_as_eb_RAM[TaskID];
+    ev = E_OK;
+  }
+
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* __PRIVATE_GETEXECUTIONBUDGETSTATS__ */
+
+StatusType EE_as_SetExecutionBudgetDivider ( EE_UINT32 Divider )
+{
+#ifdef __OO_EXTENDED_STATUS__
+  if ( Divider == 0U ) {
+    return E_OS_VALUE;
+  }
+#endif /* __OO_EXTENDED_STATUS__ */
+
+  /* The cycles so far are weighted with the old divider */
+  EE_as_eb_arrival_base = EE_as_eb_arrival_now();
+  EE_as_eb_arrival_dwt  = EE_cortex_mx_dwt_cycles();
+  EE_as_eb_divider      = Divider;
+
+  return E_OK;
+}
+
+#endif /* EE_EXECUTION_BUDGET__ */
@@ -153,7 +153,16 @@ __OO_EXTENDED_STATUS__ */
           tick value of the counter via <Value> and return E_OK.
          [OS531]: ... for counters of OsCounterType = SOFTWARE the current
           “software” tick value is returned. */
-      *Value = EE_counter_RAM[CounterID].value;
+#ifdef EE_HR_COUNTER__
+      if ( CounterID == EE_HR_COUNTER ) {
+        /* [OS532]: ... for counters of OsCounterType = HARDWARE the current
+            tick value of the hardware timer is returned. */
+        *Value = EE_hr_timer_read() & EE_HR_COUNTER_MAXALLOWEDVALUE;
+      } else
+#endif /* EE_HR_COUNTER__ */
+      {
+        *Value = EE_counter_RAM[CounterID].value;
+      }
 
       ev = E_OK;
     }
@@ -155,6 +155,15 @@ StatusType EE_oo_GetElapsedValue(CounterType CounterID, TickRefType Value,
     if ( *Value > EE_counter_ROM[CounterID].maxallowedvalue ) {
       ev = E_OS_VALUE;
     } else {
+      register TickType current = EE_counter_RAM[CounterID].value;
+
+#ifdef EE_HR_COUNTER__
+      /* The high resolution counter is the hardware timer itself */
+      if ( CounterID == EE_HR_COUNTER ) {
+        current = EE_hr_timer_read() & EE_HR_COUNTER_MAXALLOWEDVALUE;
+      }
+#endif /* EE_HR_COUNTER__ */
+
       /* [OS382]: If the input parameters in a call of GetElapsedValue() are
           valid, GetElapsedValue() shall return the number of elapsed ticks
           since the given <Value> value via <ElapsedValue> and shall return
@@ -163,12 +172,12 @@ StatusType EE_oo_GetElapsedValue(CounterType CounterID, TickRefType Value,
         <Value> value a second (or multiple) time, the result returned is wrong.
         The reason is that the service can not detect such a relative overflow.
       */
-      *ElapsedValue = (EE_counter_RAM[CounterID].value >= *Value) ?
+      *ElapsedValue = (current >= *Value) ?
         /* Timer did not pass the <value> yet */
-        (EE_counter_RAM[CounterID].value - *Value) :
+        (current - *Value) :
         /* Timer already passed the <value> */
         ((EE_counter_ROM[CounterID].maxallowedvalue -
-        (*Value - EE_counter_RAM[CounterID].value)) + 1U);
+        (*Value - current)) + 1U);
 
         ev = E_OK;
     }
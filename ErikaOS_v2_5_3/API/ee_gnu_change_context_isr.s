@@ -92,7 +92,10 @@
 @*******************************************************************************
 @                              CODE SECTION
 @*******************************************************************************
-	.text
+@ The context change is linked into .ramfunc like the C kernel paths marked
+@ with EE_COMPILER_RAMFUNC. Whether it runs from SRAM or from flash is decided
+@ by the region of .ramfunc in the linker script.
+	.section .ramfunc, "ax", %progbits
 
 @ kernel code is in ARM-mode
 	.syntax unified
@@ -54,7 +54,7 @@
 #ifndef __PRIVATE_RQ2STK_EXCHANGE__
 
 #if (defined(__OO_BCC1__)) || (defined(__OO_ECC1__))
-EE_TID EE_rq2stk_exchange(void)
+EE_COMPILER_RAMFUNC EE_TID EE_rq2stk_exchange(void)
 {
   EE_TID temp;
 
@@ -71,7 +71,7 @@ EE_TID EE_rq2stk_exchange(void)
 #endif
 
 #if (defined(__OO_BCC2__)) || (defined(__OO_ECC2__))
-EE_TID EE_rq2stk_exchange(void)
+EE_COMPILER_RAMFUNC EE_TID EE_rq2stk_exchange(void)
 {
   EE_INT8 x;    /* the first non-empty queue */
   EE_TID temp;   /* the TID to be inserted in the top of the stack */
@@ -54,7 +54,7 @@
 #ifndef __PRIVATE_RQ2STK_EXCHANGE__
 
 #if defined(__OO_BCC2__) || defined(__OO_ECC2__)
-EE_TID EE_rq_queryfirst(void)
+EE_COMPILER_RAMFUNC EE_TID EE_rq_queryfirst(void)
 {
   EE_INT8 x;
 
@@ -69,7 +69,7 @@ static EE_BIT EE_thread_rnact_max(EE_TID current) {
 static void EE_thread_endcycle_next(void);
 
 #if (defined(__OO_ECC1__)) || (defined(__OO_ECC2__))
-static void EE_thread_endcycle_next(void)
+static EE_COMPILER_RAMFUNC void EE_thread_endcycle_next(void)
 {
   register EE_TID nexttid;
   nexttid = EE_rq2stk_exchange();
@@ -87,14 +87,14 @@ static void EE_thread_endcycle_next(void)
   /* Remember: after hal_endcycle_XXX there MUST be NOTHING!!! */
 }
 #else /* __OO_ECC1__ || __OO_ECC2__ */
-static void EE_thread_endcycle_next(void)
+static EE_COMPILER_RAMFUNC void EE_thread_endcycle_next(void)
 {
   EE_hal_endcycle_ready(EE_rq2stk_exchange());
   /* Remember: after hal_endcycle_XXX there MUST be NOTHING!!! */
 }
 #endif /* __OO_ECC1__ || __OO_ECC2__ */
 
-void EE_thread_end_instance(void)
+EE_COMPILER_RAMFUNC void EE_thread_end_instance(void)
 {
   EE_TID current, rqfirst;
   EE_TID ntask;
@@ -1534,26 +1534,32 @@
 #if EE_MAX_COUNTER
     const EE_oo_counter_ROM_type EE_counter_ROM[EE_COUNTER_ROM_SIZE] = {
         {OSMAXALLOWEDVALUE_`@Counter_1_Name`, OSTICKSPERBASE_`@Counter_1_Name`, OSMINCYCLE_`@Counter_1_Name`} /* `@Counter_1_Name` */
-        #if EE_COUNTER_ROM_SIZE > 1
+        #if EE_MAX_COUNTER_CFG > 1
         ,{OSMAXALLOWEDVALUE_`@Counter_2_Name`, OSTICKSPERBASE_`@Counter_2_Name`, OSMINCYCLE_`@Counter_2_Name`} /* `@Counter_2_Name` */
         #endif
-        #if EE_COUNTER_ROM_SIZE > 2
+        #if EE_MAX_COUNTER_CFG > 2
         ,{OSMAXALLOWEDVALUE_`@Counter_3_Name`, OSTICKSPERBASE_`@Counter_3_Name`, OSMINCYCLE_`@Counter_3_Name`} /* `@Counter_3_Name` */
         #endif
-        #if EE_COUNTER_ROM_SIZE > 3
+        #if EE_MAX_COUNTER_CFG > 3
         ,{OSMAXALLOWEDVALUE_`@Counter_4_Name`, OSTICKSPERBASE_`@Counter_4_Name`, OSMINCYCLE_`@Counter_4_Name`} /* `@Counter_4_Name` */
         #endif
+        #ifdef EE_HR_COUNTER__
+        ,{EE_HR_COUNTER_MAXALLOWEDVALUE, EE_HR_COUNTER_TICKSPERBASE, EE_HR_COUNTER_MINCYCLE} /* high resolution counter */
+        #endif
     };
 
     EE_oo_counter_RAM_type       EE_counter_RAM[EE_MAX_COUNTER] = {
         {0U, (EE_TYPECOUNTEROBJECT)-1}
-        #if EE_MAX_COUNTER > 1
+        #if EE_MAX_COUNTER_CFG > 1
+        ,{0U, (EE_TYPECOUNTEROBJECT)-1}
+        #endif
+        #if EE_MAX_COUNTER_CFG > 2
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
-        #if EE_MAX_COUNTER > 2
+        #if EE_MAX_COUNTER_CFG > 3
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
-        #if EE_MAX_COUNTER > 3
+        #ifdef EE_HR_COUNTER__
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
     };
@@ -1685,34 +1691,67 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
 #if EE_COUNTER_OBJECTS_ROM_SIZE
     const EE_oo_counter_object_ROM_type   EE_oo_counter_object_ROM[EE_COUNTER_OBJECTS_ROM_SIZE] = {
         #if EE_MAX_ALARM > 0
-        {`@Alarm_1_Counter`, `@Alarm_1_Name`, EE_ALARM }
+        {EE_ALARM_COUNTER(`@Alarm_1_Name`, `@Alarm_1_Counter`), `@Alarm_1_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 1
-        ,{`@Alarm_2_Counter`, `@Alarm_2_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_2_Name`, `@Alarm_2_Counter`), `@Alarm_2_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 2
-        ,{`@Alarm_3_Counter`, `@Alarm_3_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_3_Name`, `@Alarm_3_Counter`), `@Alarm_3_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 3
-        ,{`@Alarm_4_Counter`, `@Alarm_4_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_4_Name`, `@Alarm_4_Counter`), `@Alarm_4_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 4
-        ,{`@Alarm_5_Counter`, `@Alarm_5_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_5_Name`, `@Alarm_5_Counter`), `@Alarm_5_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 5
-        ,{`@Alarm_6_Counter`, `@Alarm_6_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_6_Name`, `@Alarm_6_Counter`), `@Alarm_6_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 6
-        ,{`@Alarm_7_Counter`, `@Alarm_7_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_7_Name`, `@Alarm_7_Counter`), `@Alarm_7_Name`, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 7
-        ,{`@Alarm_8_Counter`, `@Alarm_8_Name`, EE_ALARM }
+        ,{EE_ALARM_COUNTER(`@Alarm_8_Name`, `@Alarm_8_Counter`), `@Alarm_8_Name`, EE_ALARM }
+        #endif
+        #if EE_MAX_SCHEDULETABLE > 0
+        EE_SCHEDTAB_COUNTER_OBJECTS
         #endif
     };
 
     EE_oo_counter_object_RAM_type EE_oo_counter_object_RAM[EE_COUNTER_OBJECTS_ROM_SIZE];
 #endif
 
+/***************************************************************************
+ *
+ * Scheduling Tables
+ *
+ **************************************************************************/
+#if EE_MAX_SCHEDULETABLE > 0
+    const EE_as_Expiry_Point_ROM_type EE_as_Expiry_Point_ROM[EE_SCHEDTAB_EXPIRY_POINTS] = {
+        EE_SCHEDTAB_EXPIRY_POINTS_ROM
+    };
+
+    const EE_as_Schedule_Table_ROM_type EE_as_Schedule_Table_ROM[EE_MAX_SCHEDULETABLE] = {
+        EE_SCHEDTAB_ROM
+    };
+
+    EE_as_Schedule_Table_RAM_type EE_as_Schedule_Table_RAM[EE_MAX_SCHEDULETABLE] = {
+        EE_SCHEDTAB_RAM
+    };
+#endif
+
+/***************************************************************************
+ *
+ * Execution Budgets
+ *
+ **************************************************************************/
+#ifdef EE_EXECUTION_BUDGET__
+    const EE_as_eb_ROM_type EE_as_eb_ROM[EE_MAX_TASK] = {
+        EE_EXEC_BUDGET_ROM
+    };
+#endif
+
 /***************************************************************************
  *
  * Alarms and Scheduling Tables actions
@@ -1720,7 +1759,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
  **************************************************************************/
 #if EE_ACTION_ROM_SIZE
     const EE_oo_action_ROM_type   EE_oo_action_ROM[EE_ACTION_ROM_SIZE] = {
-    #if EE_ACTION_ROM_SIZE > 0
+    #if EE_MAX_ALARM > 0
         {`@Alarm_1_Action`    , 
             #if `@Alarm_1_Action` != 3 
                 `@Alarm_1_Task`,
@@ -1739,7 +1778,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 1
+    #if EE_MAX_ALARM > 1
         ,{`@Alarm_2_Action`    , 
             #if `@Alarm_2_Action` != 3 
                 `@Alarm_2_Task`,
@@ -1758,7 +1797,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 2
+    #if EE_MAX_ALARM > 2
         ,{`@Alarm_3_Action`    , 
             #if `@Alarm_3_Action` != 3 
                 `@Alarm_3_Task`,
@@ -1777,7 +1816,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 3
+    #if EE_MAX_ALARM > 3
         ,{`@Alarm_4_Action`    , 
             #if `@Alarm_4_Action` != 3 
                 `@Alarm_4_Task`,
@@ -1796,7 +1835,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 4
+    #if EE_MAX_ALARM > 4
         ,{`@Alarm_5_Action`    , 
             #if `@Alarm_5_Action` != 3 
                 `@Alarm_5_Task`,
@@ -1815,7 +1854,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 5
+    #if EE_MAX_ALARM > 5
         ,{`@Alarm_6_Action`    , 
             #if `@Alarm_6_Action` != 3 
                 `@Alarm_6_Task`,
@@ -1834,7 +1873,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 6
+    #if EE_MAX_ALARM > 6
         ,{`@Alarm_7_Action`    , 
             #if `@Alarm_7_Action` != 3 
                 `@Alarm_7_Task`,
@@ -1853,7 +1892,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 7
+    #if EE_MAX_ALARM > 7
         ,{`@Alarm_8_Action`    , 
             #if `@Alarm_8_Action` != 3 
                 `@Alarm_8_Task`,
@@ -1872,6 +1911,9 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif   
+    #if EE_SCHEDTAB_ACTIONS > 0
+        EE_SCHEDTAB_ACTIONS_ROM
+    #endif
     };
 #endif
 
@@ -0,0 +1,171 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+/*
+ * Critical section profiling: length of every period with the interrupts
+ * masked through the HAL (kernel primitives and Suspend/Disable
+ * (All|OS)Interrupts), with the longest section of each call site.
+ */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "ErikaOS_ee_internal.inc"
+
+#ifdef EE_CS_PROFILE__
+
+/* Site recorded for a section: the code the masking HAL function was
+   inlined into, so the kernel service or the application function */
+#ifdef __GNUC__
+#define EE_CS_PROFILE_CALLER()  __builtin_return_address(0)
+#else /* __GNUC__ */
+#define EE_CS_PROFILE_CALLER()  ((EE_ADDR)0)
+#endif /* __GNUC__ */
+
+/* Statistics, only accessed with interrupts masked */
+static EE_cs_profile_type EE_cs_profile;
+
+/* Open section: start time and site, EE_FALSE if the interrupts were masked
+   without the HAL (ISR stubs, context switch) */
+static EE_TYPEBOOL  EE_cs_profile_open = EE_FALSE;
+static EE_UINT32    EE_cs_profile_start;
+static EE_ADDR      EE_cs_profile_site;
+
+void EE_cs_profile_begin(void)
+{
+  EE_cs_profile_site  = EE_CS_PROFILE_CALLER();
+  EE_cs_profile_open  = EE_TRUE;
+  /* Last, to leave the profiler's own cost out of the section */
+  EE_cs_profile_start = EE_cortex_mx_dwt_cycles();
+}
+
+void EE_cs_profile_end(void)
+{
+  register EE_UINT32 const cycles =
+    EE_cortex_mx_dwt_cycles() - EE_cs_profile_start;
+  register EE_UINT8 i;
+  register EE_UINT8 shortest = 0U;
+
+  if ( EE_cs_profile_open != EE_FALSE ) {
+    EE_cs_profile_open = EE_FALSE;
+    ++EE_cs_profile.sections;
+
+    /* Existing site, a free slot or the shortest of the top list */
+    for ( i = 0U; i < EE_CS_PROFILE_TOP_N; ++i ) {
+      register EE_cs_profile_entry_type * const p_entry =
+        &EE_cs_profile.top[i];
+
+      if ( (p_entry->site == EE_cs_profile_site) || (p_entry->count == 0U) ) {
+        break;
+      }
+      if ( p_entry->max_cycles < EE_cs_profile.top[shortest].max_cycles ) {
+        shortest = i;
+      }
+    }
+
+    if ( i < EE_CS_PROFILE_TOP_N ) {
+      register EE_cs_profile_entry_type * const p_entry =
+        &EE_cs_profile.top[i];
+
+      p_entry->site = EE_cs_profile_site;
+      ++p_entry->count;
+      if ( cycles > p_entry->max_cycles ) {
+        p_entry->max_cycles = cycles;
+      }
+    } else if ( cycles > EE_cs_profile.top[shortest].max_cycles ) {
+      /* New site longer than the shortest of the list: replace it */
+      ++EE_cs_profile.dropped;
+      EE_cs_profile.top[shortest].site       = EE_cs_profile_site;
+      EE_cs_profile.top[shortest].max_cycles = cycles;
+      EE_cs_profile.top[shortest].count      = 1U;
+    } else {
+      ++EE_cs_profile.dropped;
+    }
+  }
+}
+
+void EE_cs_profile_reset(void)
+{
+  register EE_FREG const flag = EE_cortex_mx_suspendIRQ();
+  register EE_UINT8 i;
+
+  EE_cortex_mx_dwt_start();
+
+  EE_cs_profile.sections = 0U;
+  EE_cs_profile.dropped  = 0U;
+  for ( i = 0U; i < EE_CS_PROFILE_TOP_N; ++i ) {
+    EE_cs_profile.top[i].site       = (EE_ADDR)0;
+    EE_cs_profile.top[i].max_cycles = 0U;
+    EE_cs_profile.top[i].count      = 0U;
+  }
+
+  EE_cortex_mx_resumeIRQ(flag);
+}
+
+void EE_cs_profile_read(EE_cs_profile_type * snapshot)
+{
+  register EE_UINT8 i;
+  register EE_UINT8 j;
+
+  if ( snapshot != NULL ) {
+    /* Raw masking: the copy itself is not a profiled section */
+    register EE_FREG const flag = EE_cortex_mx_suspendIRQ();
+    *snapshot = EE_cs_profile;
+    EE_cortex_mx_resumeIRQ(flag);
+
+    /* Insertion sort by decreasing length, N is small */
+    for ( i = 1U; i < EE_CS_PROFILE_TOP_N; ++i ) {
+      EE_cs_profile_entry_type const entry = snapshot->top[i];
+      j = i;
+      while ( (j > 0U) &&
+        (snapshot->top[j - 1U].max_cycles < entry.max_cycles) )
+      {
+        snapshot->top[j] = snapshot->top[j - 1U];
+        --j;
+      }
+      snapshot->top[j] = entry;
+    }
+  }
+}
+
+#endif /* EE_CS_PROFILE__ */
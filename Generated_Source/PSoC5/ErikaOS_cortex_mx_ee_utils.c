@@ -104,7 +104,7 @@ void EE_system_init(void)
     ramVectorTable[CY_INT_IRQ_BASE + (isr_buttons__INTC_NUMBER & CY_INT_NUMBER_MASK)] = isr_buttons;
 	//PF v2.5.3
     //NVIC_SET_PRI(isr_buttons__INTC_NUMBER, (ISR_MIN_PRI - 1));
-    CyIntSetPriority(isr_buttons__INTC_NUMBER, ISR_SCALE(1));
+    CyIntSetPriority(isr_buttons__INTC_NUMBER, ISR_SCALE(0));
     //\PF
 	NVIC_INT_ENABLE(isr_buttons__INTC_NUMBER);
 #elif Number_of_ISRs > 0
@@ -0,0 +1,240 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+ /** @file      ee_as_schedule_tables.c
+  *  @brief     Schedule Tables services (relative start, stop, status).
+  *             Expiry point processing lives in EE_as_handle_schedule_table
+  *             (ee_altick.c), driven by the counter object EE_MAX_ALARM + ID.
+  */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "ErikaOS_ee_internal.inc"
+
+#if (defined(EE_AS_SCHEDULETABLES__)) && (defined(EE_MAX_SCHEDULETABLE)) &&\
+  (EE_MAX_SCHEDULETABLE > 0U)
+
+#ifndef __PRIVATE_STARTSCHEDULETABLEREL__
+StatusType EE_as_StartScheduleTableRel( ScheduleTableType ScheduleTableID,
+  TickType Offset )
+{
+  /* Error Value */
+  register StatusType ev;
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  EE_ORTI_set_service_in(EE_SERVICETRACE_STARTSCHEDULETABLEREL);
+
+  EE_as_monitoring_the_stack();
+
+#ifdef EE_SERVICE_PROTECTION__
+  if ( EE_as_execution_context > ISR2_Context ) {
+    ev = E_OS_CALLEVEL;
+  } else if ( EE_oo_check_disableint_error() ) {
+    ev = E_OS_DISABLEDINT;
+  } else
+#endif /* EE_SERVICE_PROTECTION__ */
+#ifdef __OO_EXTENDED_STATUS__
+  /* [OS275]: If the schedule table ScheduleTableID in a call of
+      StartScheduleTableRel() is not valid, StartScheduleTableRel() shall
+      return E_OS_ID. */
+  if ( ScheduleTableID >= EE_MAX_SCHEDULETABLE ) {
+    ev = E_OS_ID;
+  } else
+  /* [OS332]: If Offset is zero, StartScheduleTableRel() shall return
+      E_OS_VALUE. [OS276]: If the offset is greater than
+      OsCounterMaxAllowedValue of the underlying counter minus the Initial
+      Offset, StartScheduleTableRel() shall return E_OS_VALUE. */
+  if ( (Offset == 0U) || (Offset > (EE_counter_ROM[EE_oo_counter_object_ROM[
+      EE_MAX_ALARM + ScheduleTableID].c].maxallowedvalue -
+      EE_as_Expiry_Point_ROM[EE_as_Schedule_Table_ROM[ScheduleTableID].
+      expiry_point_first].offset)) )
+  {
+    ev = E_OS_VALUE;
+  } else
+#endif /* __OO_EXTENDED_STATUS__ */
+  /* [OS277]: If the schedule table ScheduleTableID in a call of
+      StartScheduleTableRel() is not in the state SCHEDULETABLE_STOPPED,
+      StartScheduleTableRel() shall return E_OS_STATE. */
+  if ( EE_as_Schedule_Table_RAM[ScheduleTableID].status !=
+      SCHEDULETABLE_STOPPED )
+  {
+    ev = E_OS_STATE;
+  } else {
+    register EE_as_Schedule_Table_RAM_type * const p_schedule_table_RAM =
+      &EE_as_Schedule_Table_RAM[ScheduleTableID];
+    register ExpiryPointType const first =
+      EE_as_Schedule_Table_ROM[ScheduleTableID].expiry_point_first;
+
+    /* [OS278]: start the processing of the schedule table "Offset" ticks
+        from now and set its state to SCHEDULETABLE_RUNNING. */
+    p_schedule_table_RAM->status      = SCHEDULETABLE_RUNNING;
+    p_schedule_table_RAM->position    = first;
+    p_schedule_table_RAM->deviation   = 0U;
+    p_schedule_table_RAM->next_table  = INVALID_SCHEDULETABLE;
+
+    /* The Initial Expiry Point is processed Offset + its offset ticks from
+       now; every following expiry point reschedules the same counter object
+       through its cntcycle (see EE_as_handle_schedule_table) */
+    EE_oo_handle_rel_counter_object_insertion(EE_MAX_ALARM + ScheduleTableID,
+      Offset + EE_as_Expiry_Point_ROM[first].offset, 0U);
+    ev = E_OK;
+  }
+
+  if ( ev != E_OK ) {
+    EE_ORTI_set_lasterror(ev);
+    EE_oo_notify_error_service(OSServiceId_StartScheduleTableRel, ev);
+  }
+
+  EE_ORTI_set_service_out(EE_SERVICETRACE_STARTSCHEDULETABLEREL);
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* !__PRIVATE_STARTSCHEDULETABLEREL__ */
+
+#ifndef __PRIVATE_STOPSCHEDULETABLE__
+StatusType EE_as_StopScheduleTable( ScheduleTableType ScheduleTableID )
+{
+  /* Error Value */
+  register StatusType ev;
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  EE_ORTI_set_service_in(EE_SERVICETRACE_STOPSCHEDULETABLE);
+
+  EE_as_monitoring_the_stack();
+
+#ifdef EE_SERVICE_PROTECTION__
+  if ( EE_as_execution_context > ISR2_Context ) {
+    ev = E_OS_CALLEVEL;
+  } else if ( EE_oo_check_disableint_error() ) {
+    ev = E_OS_DISABLEDINT;
+  } else
+#endif /* EE_SERVICE_PROTECTION__ */
+#ifdef __OO_EXTENDED_STATUS__
+  /* [OS279]: If the schedule table identifier ScheduleTableID in a call of
+      StopScheduleTable() is not valid, StopScheduleTable() shall return
+      E_OS_ID. */
+  if ( ScheduleTableID >= EE_MAX_SCHEDULETABLE ) {
+    ev = E_OS_ID;
+  } else
+#endif /* __OO_EXTENDED_STATUS__ */
+  /* [OS280]: If the schedule table with identifier ScheduleTableID is in
+      state SCHEDULETABLE_STOPPED when calling StopScheduleTable(),
+      StopScheduleTable() shall return E_OS_NOFUNC. */
+  if ( EE_as_Schedule_Table_RAM[ScheduleTableID].status ==
+      SCHEDULETABLE_STOPPED )
+  {
+    ev = E_OS_NOFUNC;
+  } else {
+    register EE_as_Schedule_Table_RAM_type * const p_schedule_table_RAM =
+      &EE_as_Schedule_Table_RAM[ScheduleTableID];
+
+    /* [OS281]: cancel the processing and set the state to
+        SCHEDULETABLE_STOPPED. */
+    if ( EE_oo_counter_object_RAM[EE_MAX_ALARM + ScheduleTableID].used ) {
+      EE_oo_handle_counter_object_cancellation(EE_MAX_ALARM +
+        ScheduleTableID);
+    }
+    /* [OS453]: a table queued as "next" is stopped together with it */
+    if ( p_schedule_table_RAM->next_table != INVALID_SCHEDULETABLE ) {
+      EE_as_Schedule_Table_RAM[p_schedule_table_RAM->next_table].status =
+        SCHEDULETABLE_STOPPED;
+      p_schedule_table_RAM->next_table = INVALID_SCHEDULETABLE;
+    }
+    p_schedule_table_RAM->status    = SCHEDULETABLE_STOPPED;
+    p_schedule_table_RAM->position  = INVALID_SCHEDULETABLE_POSITION;
+    ev = E_OK;
+  }
+
+  if ( ev != E_OK ) {
+    EE_ORTI_set_lasterror(ev);
+    EE_oo_notify_error_service(OSServiceId_StopScheduleTable, ev);
+  }
+
+  EE_ORTI_set_service_out(EE_SERVICETRACE_STOPSCHEDULETABLE);
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* !__PRIVATE_STOPSCHEDULETABLE__ */
+
+#ifndef __PRIVATE_GETSCHEDULETABLESTATUS__
+StatusType EE_as_GetScheduleTableStatus( ScheduleTableType ScheduleTableID,
+  ScheduleTableStatusRefType ScheduleStatus )
+{
+  /* Error Value */
+  register StatusType ev;
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  EE_ORTI_set_service_in(EE_SERVICETRACE_GETSCHEDULETABLESTATUS);
+
+#ifdef __OO_EXTENDED_STATUS__
+  /* [OS293]: If the identifier ScheduleTableID in a call of
+      GetScheduleTableStatus() is not valid, GetScheduleTableStatus() shall
+      return E_OS_ID. */
+  if ( ScheduleTableID >= EE_MAX_SCHEDULETABLE ) {
+    ev = E_OS_ID;
+  } else
+#endif /* __OO_EXTENDED_STATUS__ */
+  {
+    *ScheduleStatus = EE_as_Schedule_Table_RAM[ScheduleTableID].status;
+    ev = E_OK;
+  }
+
+  if ( ev != E_OK ) {
+    EE_ORTI_set_lasterror(ev);
+    EE_oo_notify_error_service(OSServiceId_GetScheduleTableStatus, ev);
+  }
+
+  EE_ORTI_set_service_out(EE_SERVICETRACE_GETSCHEDULETABLESTATUS);
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* !__PRIVATE_GETSCHEDULETABLESTATUS__ */
+
+#endif /* EE_AS_SCHEDULETABLES__ && EE_MAX_SCHEDULETABLE > 0U */
@@ -0,0 +1,100 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "ErikaOS_ee_internal.inc"
+
+/* SetEventFromISR:
+   - implementation defined fast path of SetEvent for ISR2 bodies which
+     signal a fixed, known extended task (e.g. the target of a button ISR)
+   - the target is validated by the caller, at design time: no id, access
+     or state checks, no error hook, no ORTI/trace service tracking
+   - constant time: OR of the event mask and, if the task was waiting for
+     one of the events, a single ready queue insertion. No preemption point
+     here: the ISR2 epilogue (EE_IRQ_end_instance) reschedules on exit
+   - must not be called at task level or from category 1 ISRs: without a
+     preemption point a task level call would only wake the task at the
+     next rescheduling
+   - returns (only extended state)
+       E_OS_CALLEVEL if called at task level, nothing is set
+   Note: setting events of a SUSPENDED task is harmless here, the mask is
+   cleared again on its next activation.
+*/
+#if (defined(__OO_ECC1__)) || (defined(__OO_ECC2__))
+#ifndef __PRIVATE_SETEVENTFROMISR__
+StatusType EE_oo_SetEventFromISR(TaskType TaskID, EventMaskType Mask)
+{
+  register EE_FREG flag;
+
+#ifdef __OO_EXTENDED_STATUS__
+  /* Debug builds catch the task level misuse */
+  if ( EE_hal_get_IRQ_nesting_level() == 0U ) {
+    EE_ORTI_set_lasterror(E_OS_CALLEVEL);
+    return E_OS_CALLEVEL;
+  }
+#endif /* __OO_EXTENDED_STATUS__ */
+
+  /* Only the interrupts nested above this ISR2 have to be locked out */
+  flag = EE_hal_begin_nested_primitive();
+
+  EE_th_event_active[TaskID] |= Mask;
+
+  /* See EE_oo_SetEvent: the WAITING test avoids a double insertion when
+     the same event is set twice before the task runs */
+  if ( ((EE_th_event_waitmask[TaskID] & Mask) != 0U) &&
+    (EE_th_status[TaskID] == WAITING) )
+  {
+    if ( EE_as_tp_handle_interarrival(EE_AS_TP_ID_FROM_TASK(TaskID)) ) {
+      EE_th_status[TaskID] = READY;
+      EE_rq_insert(TaskID);
+    }
+  }
+
+  EE_hal_end_nested_primitive(flag);
+
+  return E_OK;
+}
+#endif /* __PRIVATE_SETEVENTFROMISR__ */
+#endif /* defined(__OO_ECC1__) || defined(__OO_ECC2__) */
@@ -0,0 +1,177 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "ErikaOS_ee_internal.inc"
+
+#if (defined(__OO_BCC1__) || defined(__OO_BCC2__) || defined(__OO_ECC1__) || defined(__OO_ECC2__)) && defined(EE_HR_COUNTER__)
+
+/* High resolution counter:
+   - one more counter (EE_HR_COUNTER, appended after the customizer counters
+     by eecfg.inc) whose value is a free running hardware timer of the
+     application, read with EE_hr_timer_read(). The timer has to wrap at
+     EE_HR_COUNTER_MAXALLOWEDVALUE, which must be 2^n - 1
+   - there is no periodic tick: the delta queue of the counter is advanced
+     by HrCounterTick(), called from the ISR2 of the compare match of the
+     timer, and up to the first expiry whenever a counter object is inserted
+   - after each change the compare is programmed one-shot to the first
+     expiry with EE_hr_timer_set_compare(), an expiry the timer has already
+     passed is raised with EE_hr_timer_trigger() instead of waiting for the
+     wrap around
+   - GetCounterValue and GetElapsedValue read the timer, IncrementCounter
+     rejects the counter with E_OS_ID (extended status)
+*/
+
+/* Set while HrCounterTick() expires counter objects: the actions may insert
+   counter objects, these are relative to the tick being processed and the
+   compare is programmed once at the end */
+static EE_TYPEBOOL EE_hr_counter_ticking = EE_FALSE;
+
+/* Ticks the timer is ahead of the counter value */
+__INLINE__ TickType EE_oo_hr_counter_elapsed( void )
+{
+  return (EE_hr_timer_read() - EE_counter_RAM[EE_HR_COUNTER].value) &
+    EE_HR_COUNTER_MAXALLOWEDVALUE;
+}
+
+/* Move the counter value forward without expiring anything */
+__INLINE__ void EE_oo_hr_counter_skip( TickType ticks )
+{
+  EE_counter_RAM[EE_HR_COUNTER].value =
+    (EE_counter_RAM[EE_HR_COUNTER].value + ticks) &
+    EE_HR_COUNTER_MAXALLOWEDVALUE;
+}
+
+TickType EE_oo_hr_counter_sync( void )
+{
+  register TickType elapsed = 0U;
+
+  if ( EE_hr_counter_ticking == EE_FALSE ) {
+    register CounterObjectType const first = EE_counter_RAM[EE_HR_COUNTER].first;
+    register TickType skip;
+
+    elapsed = EE_oo_hr_counter_elapsed();
+    skip    = elapsed;
+
+    if ( first != INVALID_COUNTER_OBJECT ) {
+      /* Stop one tick before the first expiry, expiring is left to the
+         (pending) HrCounterTick() */
+      if ( skip > EE_oo_counter_object_RAM[first].delta ) {
+        skip = EE_oo_counter_object_RAM[first].delta;
+      }
+      EE_oo_counter_object_RAM[first].delta -= skip;
+    }
+    EE_oo_hr_counter_skip(skip);
+    elapsed -= skip;
+  }
+
+  return elapsed;
+}
+
+void EE_oo_hr_counter_program( void )
+{
+  register CounterObjectType const first = EE_counter_RAM[EE_HR_COUNTER].first;
+
+  /* With an empty queue the compare is left alone, a stale match finds
+     nothing to expire */
+  if ( (EE_hr_counter_ticking == EE_FALSE) &&
+    (first != INVALID_COUNTER_OBJECT) )
+  {
+    /* The first counter object expires delta + 1 ticks after the value */
+    register TickType const distance =
+      EE_oo_counter_object_RAM[first].delta + 1U;
+
+    EE_hr_timer_set_compare((EE_counter_RAM[EE_HR_COUNTER].value + distance) &
+      EE_HR_COUNTER_MAXALLOWEDVALUE);
+
+    /* A compare value the timer has already passed would only match after
+       a wrap around. At the very tick of the match the ISR2 may run twice,
+       the second run finds nothing to expire */
+    if ( EE_oo_hr_counter_elapsed() >= distance ) {
+      EE_hr_timer_trigger();
+    }
+  }
+}
+
+#ifndef __PRIVATE_HRCOUNTERTICK__
+void EE_oo_HrCounterTick( void )
+{
+  register TickType elapsed;
+  /* Start Critical Section */
+  register EE_FREG const flag = EE_hal_begin_nested_primitive();
+
+  EE_hr_counter_ticking = EE_TRUE;
+  elapsed = EE_oo_hr_counter_elapsed();
+
+  while ( elapsed > 0U ) {
+    register CounterObjectType const first = EE_counter_RAM[EE_HR_COUNTER].first;
+
+    if ( first == INVALID_COUNTER_OBJECT ) {
+      EE_oo_hr_counter_skip(elapsed);
+      elapsed = 0U;
+    } else {
+      /* Jump to the tick of the first expiry (or to the last elapsed tick)
+         and let the counter implementation process that tick */
+      register TickType skip = elapsed - 1U;
+
+      if ( skip > EE_oo_counter_object_RAM[first].delta ) {
+        skip = EE_oo_counter_object_RAM[first].delta;
+      }
+      EE_oo_counter_object_RAM[first].delta -= skip;
+      EE_oo_hr_counter_skip(skip);
+
+      EE_oo_IncrementCounterImplementation(EE_HR_COUNTER);
+      elapsed -= (skip + 1U);
+    }
+  }
+
+  EE_hr_counter_ticking = EE_FALSE;
+  EE_oo_hr_counter_program();
+
+  EE_hal_end_nested_primitive(flag);
+}
+#endif /* __PRIVATE_HRCOUNTERTICK__ */
+
+#endif /* EE_HR_COUNTER__ */
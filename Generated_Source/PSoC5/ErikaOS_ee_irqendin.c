@@ -125,7 +125,7 @@ __INLINE__ void  EE_IRQ_release_all_items( void ) {}
 static void EE_IRQ_run_next_task( void );
 
 #if (defined(__OO_ECC1__)) || (defined(__OO_ECC2__))
-static void EE_IRQ_run_next_task( void )
+static EE_COMPILER_RAMFUNC void EE_IRQ_run_next_task( void )
 {
   register EE_TID tnext;
   tnext = EE_rq2stk_exchange();
@@ -142,12 +142,29 @@ static void EE_IRQ_run_next_task( void )
   }
 }
 #else /* __OO_ECC1__ || __OO_ECC2__ */
-static void EE_IRQ_run_next_task( void )
+static EE_COMPILER_RAMFUNC void EE_IRQ_run_next_task( void )
 {
   EE_hal_IRQ_ready(EE_rq2stk_exchange());
 }
 #endif /* __OO_ECC1__ || __OO_ECC2__ */
 
+/* Bookkeeping when the last IRQ on the stack returns to the TASK it
+   interrupted (or to the Idle loop) without any preemption */
+static void EE_IRQ_back_to_current( EE_TID current );
+static EE_COMPILER_RAMFUNC void EE_IRQ_back_to_current( EE_TID current )
+{
+  if ( current == EE_NIL ) {
+    /* We are switching back to the Idle loop */
+    EE_as_set_execution_context( Idle_Context );
+    EE_as_tp_active_start_idle();
+  } else {
+    /* We are switching back to a preempted TASK */
+    EE_as_set_execution_context( TASK_Context );
+    /* Enable the Task Timing Protection Set */
+    EE_as_tp_active_set_from_TASK(current);
+  }
+}
+
 /* This primitive shall be atomic.
    This primitive shall be inserted as the last function in an IRQ handler.
    If the HAL allow IRQ nesting the C_end_instance should work as follows:
@@ -156,7 +173,7 @@ static void EE_IRQ_run_next_task( void )
    - if there are other interrupts on the stack the IRQ end_instance should do
      nothing
 */
-void EE_IRQ_end_instance( void )
+EE_COMPILER_RAMFUNC void EE_IRQ_end_instance( void )
 {
   register EE_TID rqfirst, current;
 
@@ -187,28 +204,40 @@ void EE_IRQ_end_instance( void )
     /* Set the next running TASK, it doesn't directly RUN it */
     EE_IRQ_run_next_task();
   } else {
-    if ( current == EE_NIL ) {
-      /* We are switching back to the Idle loop */
-      EE_as_set_execution_context( Idle_Context );
-      EE_as_tp_active_start_idle();
-    } else {
-      /* We are switching back to a preempted TASK */
-      EE_as_set_execution_context( TASK_Context );
-      /* Enable the Task Timing Protection Set */
-      EE_as_tp_active_set_from_TASK(current);
-    }
+    EE_IRQ_back_to_current(current);
     /* Set the Context Switch up, it doesn't directly switch */
     EE_hal_IRQ_stacked(current);
   }
 }
 
+/* This primitive shall be atomic.
+   Preemption test of EE_IRQ_end_instance(), for HALs which defer the
+   end_instance of the last IRQ on the stack (e.g. into the PendSV exception
+   on Cortex-M): the deferred call is only needed when a READY thread
+   preempts. Otherwise the bookkeeping of returning to the interrupted
+   context is done here and the IRQ simply returns.
+*/
+EE_COMPILER_RAMFUNC EE_TYPEBOOL EE_IRQ_need_end_instance( void )
+{
+  register EE_TID const rqfirst = EE_rq_queryfirst();
+  register EE_TYPEBOOL need_end_instance = EE_TRUE;
+
+  if ( (rqfirst == EE_NIL) || (EE_sys_ceiling >= EE_th_ready_prio[rqfirst]) )
+  {
+    EE_IRQ_back_to_current(EE_stk_queryfirst());
+    need_end_instance = EE_FALSE;
+  }
+
+  return need_end_instance;
+}
+
 /* This primitive shall be atomic.
    This primitive shall be inserted as the last function in an IRQ post-stub.
    This primitive do needed clean-up as resetting kernel interrupt nested
    counter and release gotten resources if application forget to do that as
    specified by Autosar standard.
 */
-void EE_IRQ_end_post_stub( void ) {
+EE_COMPILER_RAMFUNC void EE_IRQ_end_post_stub( void ) {
   /* [OS368]: If a Category 2 OsIsr calls DisableAllInterupts()/
       SuspendAllInterrupts()/SuspendOSInterrupts() and ends (returns)
       without calling the corresponding EnableAllInterrupts()/
@@ -0,0 +1,274 @@
+/* ###*B*###
+ * ERIKA Enterprise - a tiny RTOS for small microcontrollers
+ *
+ * Copyright (C) 2002-2008  Evidence Srl
+ *
+ * This file is part of ERIKA Enterprise.
+ *
+ * ERIKA Enterprise is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License
+ * version 2 as published by the Free Software Foundation, 
+ * (with a special exception described below).
+ *
+ * Linking this code statically or dynamically with other modules is
+ * making a combined work based on this code.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this code with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this code, you may extend
+ * this exception to your version of the code, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ * ERIKA Enterprise is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License version 2 for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with ERIKA Enterprise; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ * ###*E*### */
+
+/*
+ * PSoC Port and API Generation
+ * Carlos Fernando Meier Martinez
+ * Hochschule Darmstadt, Germany. 2017.
+ */
+
+#include "ErikaOS_ee_internal.inc"
+
+#if (defined(__OO_BCC1__) || defined(__OO_BCC2__) || defined(__OO_ECC1__) || defined(__OO_ECC2__)) && defined(__OO_MSGQ__)
+
+/* Message queues:
+   - a bounded FIFO of fixed-size records for ISR2-to-task (or task-to-task)
+     data, the records live in storage given by the application
+   - writers: ReserveMsgQ hands out the next free record, the writer fills
+     it in place and publishes it with CommitMsgQ (or drops it with
+     CancelMsgQ). Only one reservation may be open at a time, so all writers
+     of a queue must not preempt each other (e.g. one ISR2, or ISR2s of the
+     same priority)
+   - CommitMsgQ posts the "filled" semaphore, which wakes a task blocked in
+     WaitMsgQ, and sets Mask on the task given at init time, so a reader may
+     just as well wait for the records with WaitEvent
+   - reader: ReceiveMsgQ (non-blocking) or WaitMsgQ (blocking) returns the
+     oldest committed record inside the ring, ReleaseMsgQ gives the oldest
+     received record back to the writers. One reader per queue
+   - the services report through their return value only:
+       E_OS_PARAM_POINTER  NULL queue or record reference
+       E_OS_LIMIT          ReserveMsgQ: no free record
+       E_OS_STATE          reservation already open / no open reservation /
+                           no record to release
+       E_OS_NOFUNC         ReceiveMsgQ: no committed record
+*/
+
+/* Address of record idx */
+__INLINE__ void * EE_oo_msgq_record( MsgQRefType MsgQ, EE_UREG idx )
+{
+  return (void *)&MsgQ->buffer[idx * MsgQ->size];
+}
+
+/* Index following idx in the ring */
+__INLINE__ EE_UREG EE_oo_msgq_next( MsgQRefType MsgQ, EE_UREG idx )
+{
+  return ((idx + 1U) == MsgQ->length)? 0U: (idx + 1U);
+}
+
+/* Hand the oldest committed record to the reader, the caller has already
+   taken it from the "filled" semaphore */
+static void * EE_oo_msgq_take( MsgQRefType MsgQ );
+static void * EE_oo_msgq_take( MsgQRefType MsgQ )
+{
+  register EE_UREG idx;
+
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  idx = MsgQ->head + MsgQ->held;
+  if ( idx >= MsgQ->length ) {
+    idx -= MsgQ->length;
+  }
+  ++MsgQ->held;
+
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return EE_oo_msgq_record(MsgQ, idx);
+}
+
+#ifndef __PRIVATE_RESERVEMSGQ__
+StatusType EE_oo_ReserveMsgQ( MsgQRefType MsgQ, void **Record )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  if ( (MsgQ == NULL) || (Record == NULL) ) {
+    ev = E_OS_PARAM_POINTER;
+  } else if ( MsgQ->writing != EE_FALSE ) {
+    ev = E_OS_STATE;
+  } else if ( MsgQ->used == MsgQ->length ) {
+    ev = E_OS_LIMIT;
+  } else {
+    *Record = EE_oo_msgq_record(MsgQ, MsgQ->tail);
+    MsgQ->tail = EE_oo_msgq_next(MsgQ, MsgQ->tail);
+    ++MsgQ->used;
+    MsgQ->writing = EE_TRUE;
+    ev = E_OK;
+  }
+
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* __PRIVATE_RESERVEMSGQ__ */
+
+#ifndef __PRIVATE_COMMITMSGQ__
+StatusType EE_oo_CommitMsgQ( MsgQRefType MsgQ, EventMaskType Mask )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  {
+    /* Primitive Lock Procedure */
+    EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+    if ( MsgQ == NULL ) {
+      ev = E_OS_PARAM_POINTER;
+    } else if ( MsgQ->writing == EE_FALSE ) {
+      ev = E_OS_STATE;
+    } else {
+      /* The record is complete: the next writer may reserve */
+      MsgQ->writing = EE_FALSE;
+      ev = E_OK;
+    }
+
+    EE_OS_EXIT_CRITICAL_SECTION();
+  }
+
+  /* Publish the record; both services lock on their own and, at task
+     level, end with a preemption point */
+  if ( ev == E_OK ) {
+    ev = EE_oo_PostSem(&MsgQ->filled);
+  }
+#if defined(__OO_ECC1__) || defined(__OO_ECC2__)
+  if ( (ev == E_OK) && (MsgQ->task != EE_NIL) && (Mask != 0U) ) {
+    if ( EE_hal_get_IRQ_nesting_level() == 0U ) {
+      ev = EE_oo_SetEvent(MsgQ->task, Mask);
+    } else {
+      EE_oo_SetEventFromISR(MsgQ->task, Mask);
+    }
+  }
+#else /* __OO_ECC1__ || __OO_ECC2__ */
+  (void)Mask;
+#endif /* __OO_ECC1__ || __OO_ECC2__ */
+
+  return ev;
+}
+#endif /* __PRIVATE_COMMITMSGQ__ */
+
+#ifndef __PRIVATE_CANCELMSGQ__
+StatusType EE_oo_CancelMsgQ( MsgQRefType MsgQ )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  if ( MsgQ == NULL ) {
+    ev = E_OS_PARAM_POINTER;
+  } else if ( MsgQ->writing == EE_FALSE ) {
+    ev = E_OS_STATE;
+  } else {
+    /* The open reservation is always the last reserved record */
+    MsgQ->tail = ((MsgQ->tail == 0U)? MsgQ->length: MsgQ->tail) - 1U;
+    --MsgQ->used;
+    MsgQ->writing = EE_FALSE;
+    ev = E_OK;
+  }
+
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* __PRIVATE_CANCELMSGQ__ */
+
+#ifndef __PRIVATE_RECEIVEMSGQ__
+StatusType EE_oo_ReceiveMsgQ( MsgQRefType MsgQ, void **Record )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  if ( (MsgQ == NULL) || (Record == NULL) ) {
+    ev = E_OS_PARAM_POINTER;
+  } else if ( EE_oo_TryWaitSem(&MsgQ->filled) != 0 ) {
+    ev = E_OS_NOFUNC;
+  } else {
+    *Record = EE_oo_msgq_take(MsgQ);
+    ev = E_OK;
+  }
+
+  return ev;
+}
+#endif /* __PRIVATE_RECEIVEMSGQ__ */
+
+#if defined(__OO_ECC1__) || defined(__OO_ECC2__)
+#ifndef __PRIVATE_WAITMSGQ__
+StatusType EE_oo_WaitMsgQ( MsgQRefType MsgQ, void **Record )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  if ( (MsgQ == NULL) || (Record == NULL) ) {
+    ev = E_OS_PARAM_POINTER;
+  } else {
+    /* Blocks until CommitMsgQ posts, WaitSem does the call level,
+       resource and extended task checks */
+    ev = EE_oo_WaitSem(&MsgQ->filled);
+    if ( ev == E_OK ) {
+      *Record = EE_oo_msgq_take(MsgQ);
+    }
+  }
+
+  return ev;
+}
+#endif /* __PRIVATE_WAITMSGQ__ */
+#endif /* __OO_ECC1__ || __OO_ECC2__ */
+
+#ifndef __PRIVATE_RELEASEMSGQ__
+StatusType EE_oo_ReleaseMsgQ( MsgQRefType MsgQ )
+{
+  /* Error Value */
+  register StatusType ev;
+
+  /* Primitive Lock Procedure */
+  EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION();
+
+  if ( MsgQ == NULL ) {
+    ev = E_OS_PARAM_POINTER;
+  } else if ( MsgQ->held == 0U ) {
+    ev = E_OS_STATE;
+  } else {
+    MsgQ->head = EE_oo_msgq_next(MsgQ, MsgQ->head);
+    --MsgQ->held;
+    --MsgQ->used;
+    ev = E_OK;
+  }
+
+  EE_OS_EXIT_CRITICAL_SECTION();
+
+  return ev;
+}
+#endif /* __PRIVATE_RELEASEMSGQ__ */
+
+#endif /* __OO_MSGQ__ */
@@ -55,7 +55,7 @@
 
 #if (defined(__OO_BCC1__)) || (defined(__OO_ECC1__))
 /* this function inserts a task into the ready queue */
-void EE_rq_insert(EE_TID t)
+EE_COMPILER_RAMFUNC void EE_rq_insert(EE_TID t)
 {
   EE_TYPEPRIO prio;
   EE_TID p,q;
@@ -80,7 +80,7 @@ void EE_rq_insert(EE_TID t)
 #endif
 
 #if (defined(__OO_BCC2__)) || (defined(__OO_ECC2__))
-void EE_rq_insert(EE_TID t)
+EE_COMPILER_RAMFUNC void EE_rq_insert(EE_TID t)
 {
   EE_TYPEPAIR temp;
   EE_TYPEPRIO p;
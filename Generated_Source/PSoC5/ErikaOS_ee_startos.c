@@ -459,6 +459,15 @@ StatusType EE_oo_StartOS(AppModeType Mode)
          code in StartupHook */
       EE_oo_started = 1U;
 
+#ifdef EE_EXECUTION_BUDGET__
+      /* Start the budget clock before the first TASK arrives */
+      EE_as_eb_init();
+#endif /* EE_EXECUTION_BUDGET__ */
+#ifdef EE_CS_PROFILE__
+      /* Profile the critical sections of the running system only */
+      EE_cs_profile_reset();
+#endif /* EE_CS_PROFILE__ */
+
 #if (defined(__OO_HAS_STARTUPHOOK__)) || (defined(__OO_AUTOSTART_TASK__)) \
   || (defined(__OO_AUTOSTART_ALARM__)) || (defined(EE_AS_AUTOSTART_SCHEDULETABLE__))
 
@@ -1534,26 +1534,32 @@
 #if EE_MAX_COUNTER
     const EE_oo_counter_ROM_type EE_counter_ROM[EE_COUNTER_ROM_SIZE] = {
         {OSMAXALLOWEDVALUE_cnt_systick, OSTICKSPERBASE_cnt_systick, OSMINCYCLE_cnt_systick} /* cnt_systick */
-        #if EE_COUNTER_ROM_SIZE > 1
+        #if EE_MAX_COUNTER_CFG > 1
         ,{OSMAXALLOWEDVALUE_myCounter_2, OSTICKSPERBASE_myCounter_2, OSMINCYCLE_myCounter_2} /* myCounter_2 */
         #endif
-        #if EE_COUNTER_ROM_SIZE > 2
+        #if EE_MAX_COUNTER_CFG > 2
         ,{OSMAXALLOWEDVALUE_myCounter_3, OSTICKSPERBASE_myCounter_3, OSMINCYCLE_myCounter_3} /* myCounter_3 */
         #endif
-        #if EE_COUNTER_ROM_SIZE > 3
+        #if EE_MAX_COUNTER_CFG > 3
         ,{OSMAXALLOWEDVALUE_myCounter_4, OSTICKSPERBASE_myCounter_4, OSMINCYCLE_myCounter_4} /* myCounter_4 */
         #endif
+        #ifdef EE_HR_COUNTER__
+        ,{EE_HR_COUNTER_MAXALLOWEDVALUE, EE_HR_COUNTER_TICKSPERBASE, EE_HR_COUNTER_MINCYCLE} /* high resolution counter */
+        #endif
     };
 
     EE_oo_counter_RAM_type       EE_counter_RAM[EE_MAX_COUNTER] = {
         {0U, (EE_TYPECOUNTEROBJECT)-1}
-        #if EE_MAX_COUNTER > 1
+        #if EE_MAX_COUNTER_CFG > 1
+        ,{0U, (EE_TYPECOUNTEROBJECT)-1}
+        #endif
+        #if EE_MAX_COUNTER_CFG > 2
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
-        #if EE_MAX_COUNTER > 2
+        #if EE_MAX_COUNTER_CFG > 3
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
-        #if EE_MAX_COUNTER > 3
+        #ifdef EE_HR_COUNTER__
         ,{0U, (EE_TYPECOUNTEROBJECT)-1}
         #endif
     };
@@ -1570,10 +1576,10 @@
         {alrm_fader}
     #endif
     #if EE_MAX_ALARM > 1
-        ,{alrm_glower}
+        ,{alrm_seven}
     #endif
     #if EE_MAX_ALARM > 2
-        ,{alrm_seven}
+        ,{Alarm_3}
     #endif
     #if EE_MAX_ALARM > 3
         ,{Alarm_4}
@@ -1600,10 +1606,10 @@ const char* EE_ALARM_NAME[EE_MAX_ALARM]=
          "alrm_fader"
     #endif
     #if EE_MAX_ALARM > 1
-        ,"alrm_glower"
+        ,"alrm_seven"
     #endif
     #if EE_MAX_ALARM > 2
-        ,"alrm_seven"
+        ,"Alarm_3"
     #endif
     #if EE_MAX_ALARM > 3
         ,"Alarm_4"
@@ -1628,10 +1634,10 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
          alrm_fader
     #endif
     #if EE_MAX_ALARM > 1
-        ,alrm_glower
+        ,alrm_seven
     #endif
     #if EE_MAX_ALARM > 2
-        ,alrm_seven
+        ,Alarm_3
     #endif
     #if EE_MAX_ALARM > 3
         ,Alarm_4
@@ -1685,34 +1691,67 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
 #if EE_COUNTER_OBJECTS_ROM_SIZE
     const EE_oo_counter_object_ROM_type   EE_oo_counter_object_ROM[EE_COUNTER_OBJECTS_ROM_SIZE] = {
         #if EE_MAX_ALARM > 0
-        {0, alrm_fader, EE_ALARM }
+        {EE_ALARM_COUNTER(alrm_fader, 0), alrm_fader, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 1
-        ,{0, alrm_glower, EE_ALARM }
+        ,{EE_ALARM_COUNTER(alrm_seven, 0), alrm_seven, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 2
-        ,{0, alrm_seven, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_3, 0), Alarm_3, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 3
-        ,{0, Alarm_4, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_4, 0), Alarm_4, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 4
-        ,{0, Alarm_5, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_5, 0), Alarm_5, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 5
-        ,{0, Alarm_6, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_6, 0), Alarm_6, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 6
-        ,{0, Alarm_7, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_7, 0), Alarm_7, EE_ALARM }
         #endif
         #if EE_MAX_ALARM > 7
-        ,{0, Alarm_8, EE_ALARM }
+        ,{EE_ALARM_COUNTER(Alarm_8, 0), Alarm_8, EE_ALARM }
+        #endif
+        #if EE_MAX_SCHEDULETABLE > 0
+        EE_SCHEDTAB_COUNTER_OBJECTS
         #endif
     };
 
     EE_oo_counter_object_RAM_type EE_oo_counter_object_RAM[EE_COUNTER_OBJECTS_ROM_SIZE];
 #endif
 
+/***************************************************************************
+ *
+ * Scheduling Tables
+ *
+ **************************************************************************/
+#if EE_MAX_SCHEDULETABLE > 0
+    const EE_as_Expiry_Point_ROM_type EE_as_Expiry_Point_ROM[EE_SCHEDTAB_EXPIRY_POINTS] = {
+        EE_SCHEDTAB_EXPIRY_POINTS_ROM
+    };
+
+    const EE_as_Schedule_Table_ROM_type EE_as_Schedule_Table_ROM[EE_MAX_SCHEDULETABLE] = {
+        EE_SCHEDTAB_ROM
+    };
+
+    EE_as_Schedule_Table_RAM_type EE_as_Schedule_Table_RAM[EE_MAX_SCHEDULETABLE] = {
+        EE_SCHEDTAB_RAM
+    };
+#endif
+
+/***************************************************************************
+ *
+ * Execution Budgets
+ *
+ **************************************************************************/
+#ifdef EE_EXECUTION_BUDGET__
+    const EE_as_eb_ROM_type EE_as_eb_ROM[EE_MAX_TASK] = {
+        EE_EXEC_BUDGET_ROM
+    };
+#endif
+
 /***************************************************************************
  *
  * Alarms and Scheduling Tables actions
@@ -1720,7 +1759,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
  **************************************************************************/
 #if EE_ACTION_ROM_SIZE
     const EE_oo_action_ROM_type   EE_oo_action_ROM[EE_ACTION_ROM_SIZE] = {
-    #if EE_ACTION_ROM_SIZE > 0
+    #if EE_MAX_ALARM > 0
         {0    , 
             #if 0 != 3 
                 3,
@@ -1739,10 +1778,10 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 1
+    #if EE_MAX_ALARM > 1
         ,{0    , 
             #if 0 != 3 
-                4,
+                5,
             #else
                 0,
             #endif
@@ -1758,10 +1797,10 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 2
+    #if EE_MAX_ALARM > 2
         ,{0    , 
             #if 0 != 3 
-                5,
+                0,
             #else
                 0,
             #endif
@@ -1777,7 +1816,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 3
+    #if EE_MAX_ALARM > 3
         ,{0    , 
             #if 0 != 3 
                 0,
@@ -1796,7 +1835,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 4
+    #if EE_MAX_ALARM > 4
         ,{0    , 
             #if 0 != 3 
                 0,
@@ -1815,7 +1854,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 5
+    #if EE_MAX_ALARM > 5
         ,{0    , 
             #if 0 != 3 
                 0,
@@ -1834,7 +1873,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 6
+    #if EE_MAX_ALARM > 6
         ,{0    , 
             #if 0 != 3 
                 0,
@@ -1853,7 +1892,7 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif
-    #if EE_ACTION_ROM_SIZE > 7
+    #if EE_MAX_ALARM > 7
         ,{0    , 
             #if 0 != 3 
                 0,
@@ -1872,6 +1911,9 @@ const unsigned long EE_ALARM_ID[EE_MAX_ALARM]=
             #endif
             (EE_TYPECOUNTER)-1 }
     #endif   
+    #if EE_SCHEDTAB_ACTIONS > 0
+        EE_SCHEDTAB_ACTIONS_ROM
+    #endif
     };
 #endif
 
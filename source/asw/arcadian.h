@@ -71,7 +71,7 @@
  * This structure contains information related to a fader, such as the
  * current fader counter and the maximum fader value.
  */
-typedef struct {
+typedef struct Fader_t {
     uint16_t faderCounter; /**< Current value of the fader counter. */
     uint8_t maxFader;      /**< Maximum value of the fader counter. */
     uint8_t loopNumber;    /**< Current loop of the fader counter.  */
@@ -96,7 +96,7 @@ typedef struct {
  * This structure maintains the current position in the RGB glow table and
  * the elapsed time for the current RGB glow.
  */
-typedef struct {
+typedef struct RGBGlower_t {
     uint8_t currentPositionRGB;
 }RGBGlower_t;
 
@@ -0,0 +1,166 @@
+/**
+* \file board.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Instance context of one reaction game board
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "board.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void BOARD__count(BOARD_counter_t* counter);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Sets up a board from its state and the parameters of its counter.
+ *
+ * @param board Instance to set up.
+ * @param game Game state, not NULL.
+ * @param fader Fader state, not NULL.
+ * @param glower RGB glower state, not NULL.
+ * @param maxAllowedValue Counter wraps after this value, valid range 1...0xFFFFFFFF.
+ * @param ticksPerBase Ticks per counter increment, valid range 1...0xFFFFFFFF.
+ * @param onTick Work of one tick, NULL for a board which only counts.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t BOARD_Create(BOARD_t* board, struct Game_t* game, struct Fader_t* fader,
+                  struct RGBGlower_t* glower, uint32_t maxAllowedValue,
+                  uint32_t ticksPerBase, BOARD_onTick_t onTick)
+{
+    if ((board == NULL) || (game == NULL) || (fader == NULL) || (glower == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    if ((maxAllowedValue == 0) || (ticksPerBase == 0))
+    {
+        return RC_ERROR_ZERO;
+    }
+
+    board->game = game;
+    board->fader = fader;
+    board->glower = glower;
+    board->onTick = onTick;
+
+    /* Counter starts at zero like a kernel counter after StartOS() */
+    board->counter.value = 0;
+    board->counter.maxAllowedValue = maxAllowedValue;
+    board->counter.ticksPerBase = ticksPerBase;
+    board->counter.ticks = 0;
+    board->counter.elapsed = 0;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Advances the counter of a board by one tick and runs its tick work.
+ *
+ * @param board Instance set up by BOARD_Create().
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t BOARD_Tick(BOARD_t* board)
+{
+    if (board == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    BOARD__count(&board->counter);
+
+    if (board->onTick != NULL)
+    {
+        board->onTick(board);
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Advances several boards by the same number of ticks in virtual time.
+ *
+ * @param boards Array of instances set up by BOARD_Create().
+ * @param count Number of boards in the array, valid range 1...65535.
+ * @param ticks Ticks to advance every board by.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t BOARD_RunFleet(BOARD_t* boards, uint16_t count, uint32_t ticks)
+{
+    if (boards == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    if (count == 0)
+    {
+        return RC_ERROR_ZERO;
+    }
+
+    /* Lockstep, no board runs ahead of the others */
+    for (uint32_t tick = 0; tick < ticks; ++tick)
+    {
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            (void)BOARD_Tick(&boards[i]);
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Advances a counter by one tick.
+ *
+ * Every ticksPerBase ticks the value is incremented, after maxAllowedValue
+ * it wraps to zero.
+ *
+ * @param counter Counter of a board, not NULL.
+ */
+static void BOARD__count(BOARD_counter_t* counter)
+{
+    ++counter->elapsed;
+
+    if (++counter->ticks < counter->ticksPerBase)
+    {
+        return;
+    }
+
+    counter->ticks = 0;
+
+    if (counter->value >= counter->maxAllowedValue)
+    {
+        counter->value = 0;
+    }
+    else
+    {
+        ++counter->value;
+    }
+}
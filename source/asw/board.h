@@ -0,0 +1,182 @@
+/**
+* \file board.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Instance context of one reaction game board
+*
+* A board groups the application state of one device, its game, fader and
+* RGB glower, with the state of the counter driving it. Everything that
+* runs on the board is handed the board as context instead of reaching
+* file scope objects, so several boards can live in one process.
+*
+* On the target there is exactly one board, its counter mirrors cnt_systick
+* and every tick is passed to the kernel. On a host the module builds
+* without PSoC or ERIKA headers (global.h with -DOS=OS_NONE) and
+* BOARD_RunFleet() steps many boards in virtual time.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### STRUCTURES
+
+/* Only pointers are kept, the full types need the PSoC headers */
+struct Game_t;
+struct Fader_t;
+struct RGBGlower_t;
+
+/**
+ * @brief Virtual counter of a board, same semantics as an OSEK counter.
+ */
+typedef struct {
+    uint32_t value;             /**< Counter value, 0...maxAllowedValue */
+    uint32_t maxAllowedValue;   /**< Value after which the counter wraps to 0 */
+    uint32_t ticksPerBase;      /**< Ticks per increment of value */
+    uint32_t ticks;             /**< Ticks since the last increment of value */
+    uint64_t elapsed;           /**< Ticks since BOARD_Create() */
+} BOARD_counter_t;
+
+typedef struct BOARD_t BOARD_t;
+
+/**
+ * @brief Called for every tick of a board, with the board as context.
+ */
+typedef void (*BOARD_onTick_t)(BOARD_t* board);
+
+/**
+ * @brief Instance context of one board, to be set up by BOARD_Create().
+ */
+struct BOARD_t {
+    struct Game_t* game;            /**< Game state of the board */
+    struct Fader_t* fader;          /**< Fader state of the board */
+    struct RGBGlower_t* glower;     /**< RGB glower state of the board */
+    BOARD_counter_t counter;        /**< Counter driving the board */
+    BOARD_onTick_t onTick;          /**< Work of one tick, may be NULL */
+};
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class BOARD
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Sets up a board from its state and the parameters of its counter.
+ *
+ * The state objects are only referenced, they must outlive the board.
+ *
+ * @param board Instance to set up.
+ * @param game Game state, not NULL.
+ * @param fader Fader state, not NULL.
+ * @param glower RGB glower state, not NULL.
+ * @param maxAllowedValue Counter wraps after this value, valid range 1...0xFFFFFFFF.
+ * @param ticksPerBase Ticks per counter increment, valid range 1...0xFFFFFFFF.
+ * @param onTick Work of one tick, NULL for a board which only counts.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t BOARD_Create(BOARD_t* board, struct Game_t* game, struct Fader_t* fader,
+                  struct RGBGlower_t* glower, uint32_t maxAllowedValue,
+                  uint32_t ticksPerBase, BOARD_onTick_t onTick);
+
+/**
+ * @brief Advances the counter of a board by one tick and runs its tick work.
+ *
+ * Not reentrant for the same board.
+ *
+ * @param board Instance set up by BOARD_Create().
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t BOARD_Tick(BOARD_t* board);
+
+/**
+ * @brief Advances several boards by the same number of ticks in virtual time.
+ *
+ * The boards are stepped in lockstep, one tick of every board before the
+ * next tick of the first, so all boards see the same time at each tick.
+ *
+ * @param boards Array of instances set up by BOARD_Create().
+ * @param count Number of boards in the array, valid range 1...65535.
+ * @param ticks Ticks to advance every board by.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t BOARD_RunFleet(BOARD_t* boards, uint16_t count, uint32_t ticks);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* BOARD_H */
@@ -0,0 +1,112 @@
+/**
+* \file budget_cfg.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Execution budget configuration for the ErikaOS kernel
+*
+* Picked up by ErikaOS_eecfg.inc, so this file may only contain
+* pre-processor definitions: no types, no prototypes, no includes.
+* EE_EXEC_BUDGET_ROM is expanded inside EE_as_eb_ROM of ErikaOS_eecfg.c,
+* one entry per task in the order of the task identifiers.
+*
+* A job is one activation (or one release from WaitEvent) up to the
+* termination (or the next WaitEvent). Budgets are worst cases with margin,
+* a violation is counted by the kernel and reported by tsk_background.
+* The kernel cannot identify ISR2s, their budgets are checked by the runtime
+* module on RUNTIME_IsrExit().
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef BUDGET_CFG_H
+#define BUDGET_CFG_H
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define EE_EXECUTION_BUDGET__
+
+#define EE_CPU_CLOCK                24000000U   /**< Budget clock, DWT cycles at BCLK__BUS_CLK__HZ */
+
+//####################### BUDGETS [us], 0 disables the check
+
+#define BUDGET_AUTO_US              0U          /**< tsk_auto, runs once */
+#define BUDGET_BACKGROUND_US        0U          /**< tsk_background, never terminates */
+#define BUDGET_REACTIONGAME_US      10000U      /**< tsk_reactionGame, includes the UART messages */
+#define BUDGET_FADER_US             200U        /**< tsk_fader */
+#define BUDGET_GLOWER_US            200U        /**< tsk_glower */
+#define BUDGET_SEVENSEGMENT_US      100U        /**< tsk_sevenSegment */
+
+#define BUDGET_SYSTICK_US           50U         /**< systick_handler body, checked by the runtime module */
+#define BUDGET_TIMER_US             20U         /**< isr_timer body, checked by the runtime module */
+
+//####################### MINIMUM INTER-ARRIVAL TIMES [us], 0 disables the check
+
+/* Times at EE_CPU_CLOCK also while the governor divides the clock, the
+   budgets above are CPU cycles and allow more time then */
+
+#define ARRIVAL_FADER_US            900U        /**< alrm_fader, 1 ms cycle */
+#define ARRIVAL_GLOWER_US           90000U      /**< sched_glower, shortest step 100 ms */
+
+//####################### KERNEL TABLE INITIALIZERS
+
+/* {budget, minimum inter-arrival} */
+#define BUDGET_TASK(budget, arrival) \
+    {EE_AS_EB_MICRO_TO_CYCLES(budget), EE_AS_EB_MICRO_TO_CYCLES(arrival)}
+
+#define EE_EXEC_BUDGET_ROM \
+    BUDGET_TASK(BUDGET_AUTO_US, 0U), \
+    BUDGET_TASK(BUDGET_BACKGROUND_US, 0U), \
+    BUDGET_TASK(BUDGET_REACTIONGAME_US, 0U), \
+    BUDGET_TASK(BUDGET_FADER_US, ARRIVAL_FADER_US), \
+    BUDGET_TASK(BUDGET_GLOWER_US, ARRIVAL_GLOWER_US), \
+    BUDGET_TASK(BUDGET_SEVENSEGMENT_US, 0U)
+
+#endif /* BUDGET_CFG_H */
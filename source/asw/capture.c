@@ -0,0 +1,166 @@
+/**
+* \file capture.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Button capture buffer between a category 1 ISR and deferred processing
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "capture.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define CAPTURE__INDEX_MASK     (CAPTURE_BUFFER_SIZE - 1)
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/* Records are volatile so that the slot is written before the head index
+ * which publishes it (single core, no reordering of volatile accesses) */
+static volatile CAPTURE_event_t CAPTURE__buffer[CAPTURE_BUFFER_SIZE];
+
+/* Free running indices, only the low bits address the buffer.
+ * head is written by the producer only, tail by the consumer only. */
+static volatile uint8_t CAPTURE__head = 0;
+static volatile uint8_t CAPTURE__tail = 0;
+
+static volatile uint16_t CAPTURE__overruns = 0;
+
+/* Low word of the round start, intervals of a round are far below a wrap */
+static volatile uint32_t CAPTURE__roundStart = 0;
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Sets the reference of the timestamps, called when a round starts.
+ *
+ * @param start Start of the round, a TIMEBASE_Now() value.
+ * @return RC_SUCCESS
+ */
+RC_t CAPTURE_StartRound(TIMEBASE_time_t start)
+{
+    CAPTURE__roundStart = (uint32_t)start;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Records timestamp and button state, producer side.
+ *
+ * Only to be called from the category 1 button ISR: it is the single writer
+ * of the head index and does not use any OS service.
+ *
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL if the record was dropped.
+ */
+RC_t CAPTURE_Record(void)
+{
+    /* Timestamp first, everything else adds latency */
+    uint32_t elapsed = (TIMEBASE_Now32() - CAPTURE__roundStart) / TIMEBASE_CYCLES_PER_MS;
+    uint16_t timestamp = (elapsed < CAPTURE_TIMESTAMP_MAX) ? (uint16_t)elapsed : CAPTURE_TIMESTAMP_MAX;
+    uint8_t head = CAPTURE__head;
+    
+    if ((uint8_t)(head - CAPTURE__tail) >= CAPTURE_BUFFER_SIZE)
+    {
+        ++CAPTURE__overruns;
+        return RC_ERROR_BUFFER_FULL;
+    }
+    
+    uint8_t buttons = 0;
+    if (Button_Right_1_Read() == 1)
+    {
+        buttons |= CAPTURE_BUTTON_MASK(Button_Right_1);
+    }
+    if (Button_Right_2_Read() == 1)
+    {
+        buttons |= CAPTURE_BUTTON_MASK(Button_Right_2);
+    }
+    if (Button_Left_1_Read() == 1)
+    {
+        buttons |= CAPTURE_BUTTON_MASK(Button_Left_1);
+    }
+    if (Button_Left_2_Read() == 1)
+    {
+        buttons |= CAPTURE_BUTTON_MASK(Button_Left_2);
+    }
+    
+    CAPTURE__buffer[head & CAPTURE__INDEX_MASK].timestamp = timestamp;
+    CAPTURE__buffer[head & CAPTURE__INDEX_MASK].buttons = buttons;
+    
+    /* Publish the record */
+    CAPTURE__head = head + 1;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Takes the oldest record from the buffer, consumer side.
+ *
+ * Only one context (ISR2 or task) may consume.
+ *
+ * @param event Pointer receiving the record.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BUFFER_EMTPY if nothing was captured.
+ */
+RC_t CAPTURE_Get(CAPTURE_event_t *event)
+{
+    if (event == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    uint8_t tail = CAPTURE__tail;
+    
+    if (tail == CAPTURE__head)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+    
+    event->timestamp = CAPTURE__buffer[tail & CAPTURE__INDEX_MASK].timestamp;
+    event->buttons = CAPTURE__buffer[tail & CAPTURE__INDEX_MASK].buttons;
+    
+    /* Release the slot to the producer */
+    CAPTURE__tail = tail + 1;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the number of records dropped because the buffer was full.
+ *
+ * @param overruns Pointer receiving the counter.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t CAPTURE_GetOverruns(uint16_t *overruns)
+{
+    if (overruns == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    *overruns = CAPTURE__overruns;
+
+    return RC_SUCCESS;
+}
@@ -0,0 +1,156 @@
+/**
+* \file capture.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Button capture buffer between a category 1 ISR and deferred processing
+*
+* The category 1 isr_buttons only timestamps the press against the start of
+* the round on the time base and samples the four button pins. The record is handed over through
+* a single producer / single consumer ring buffer: the ISR is the only writer
+* of the head index, the consumer (an ISR2 or a task) the only writer of the
+* tail index, so neither side needs a lock or an OS service.
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "global.h"
+#include "button.h"
+#include "timebase.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define CAPTURE_BUFFER_SIZE         8       /**< Number of records, must be a power of two */
+
+/** Bit of a button in CAPTURE_event_t::buttons */
+#define CAPTURE_BUTTON_MASK(button) ((uint8_t)(1U << (button)))
+
+#define CAPTURE_TIMESTAMP_MAX       0xFFFFU /**< Timestamp of presses 65.5 s or more after the round start */
+
+//####################### STRUCTURES
+
+/**
+ * @brief One captured button interrupt.
+ */
+typedef struct {
+    uint16_t timestamp;     /**< Milliseconds since CAPTURE_StartRound(), up to CAPTURE_TIMESTAMP_MAX */
+    uint8_t  buttons;       /**< Pressed buttons, see CAPTURE_BUTTON_MASK() */
+} CAPTURE_event_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class CAPTURE
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Sets the reference of the timestamps, called when a round starts.
+ *
+ * @param start Start of the round, a TIMEBASE_Now() value.
+ * @return RC_SUCCESS
+ */
+RC_t CAPTURE_StartRound(TIMEBASE_time_t start);
+
+/**
+ * @brief Records timestamp and button state, producer side.
+ *
+ * Only to be called from the category 1 button ISR: it is the single writer
+ * of the head index and does not use any OS service.
+ *
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL if the record was dropped.
+ */
+RC_t CAPTURE_Record(void);
+
+/**
+ * @brief Takes the oldest record from the buffer, consumer side.
+ *
+ * Only one context (ISR2 or task) may consume.
+ *
+ * @param event Pointer receiving the record.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BUFFER_EMTPY if nothing was captured.
+ */
+RC_t CAPTURE_Get(CAPTURE_event_t *event);
+
+/**
+ * @brief Returns the number of records dropped because the buffer was full.
+ *
+ * @param overruns Pointer receiving the counter.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t CAPTURE_GetOverruns(uint16_t *overruns);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* CAPTURE_H */
@@ -0,0 +1,222 @@
+/**
+* \file governor.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief CPU clock governor driven by the load of the runtime accounting
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "governor.h"
+#include "runtime.h"
+#include "swtimer.h"
+#include "timebase.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define GOVERNOR__LEVELS        (sizeof(GOVERNOR__dividers) / sizeof(GOVERNOR__dividers[0]))
+#define GOVERNOR__FULL_SPEED    0U      /**< Level without divider */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/**
+ * @brief Bus clock divider per level, ascending, see governor.h for the limit.
+ */
+static const uint16_t GOVERNOR__dividers[] = {1U, 2U};
+
+static SWTIMER_t GOVERNOR__timer;                   /**< Periodic load check */
+static volatile uint8_t GOVERNOR__level = GOVERNOR__FULL_SPEED;
+static volatile uint8_t GOVERNOR__target = GOVERNOR__FULL_SPEED;   /**< Level applied by the next GOVERNOR_Tick() */
+static volatile uint16_t GOVERNOR__holdMs = 0;      /**< Remaining full speed time after a press */
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void GOVERNOR__check(void* context);
+static void GOVERNOR__setLevel(uint8_t level);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the periodic load check at full speed.
+ *
+ * TIMEBASE_Init(), SWTIMER_Init() and RUNTIME_Init() must have been called before.
+ *
+ * @return RC_SUCCESS or the error of SWTIMER_Start()
+ */
+RC_t GOVERNOR_Init(void)
+{
+    // The clocks are at full speed after reset, SysTick is not running yet
+    SuspendAllInterrupts();
+    GOVERNOR__holdMs = 0;
+    GOVERNOR__level = GOVERNOR__FULL_SPEED;
+    GOVERNOR__target = GOVERNOR__FULL_SPEED;
+    ResumeAllInterrupts();
+
+    SWTIMER_Create(&GOVERNOR__timer, GOVERNOR__check, NULL);
+
+    // One check per runtime sample, the window then holds a new sample
+    return SWTIMER_Start(&GOVERNOR__timer, RUNTIME_SAMPLE_MS, RUNTIME_SAMPLE_MS);
+}
+
+/**
+ * @brief Raises the clock to full speed for GOVERNOR_HOLD_MS, called on a button press.
+ *
+ * May be called from any task or ISR2.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t GOVERNOR_Activity(void)
+{
+    SuspendAllInterrupts();
+    GOVERNOR__holdMs = GOVERNOR_HOLD_MS;
+    GOVERNOR__target = GOVERNOR__FULL_SPEED;
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Applies a pending level change, first statement of systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t GOVERNOR_Tick(void)
+{
+    uint8_t target = GOVERNOR__target;
+
+    if (target != GOVERNOR__level)
+    {
+        GOVERNOR__setLevel(target);
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the current CPU clock.
+ *
+ * @param hz Pointer receiving the clock [Hz].
+ * @return RC_SUCCESS, RC_ERROR_NULL
+ */
+RC_t GOVERNOR_GetClock(uint32_t* hz)
+{
+    if (hz == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    *hz = BCLK__BUS_CLK__HZ / GOVERNOR__dividers[GOVERNOR__level];
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Software timer callback, lowers or raises the clock by one level.
+ *
+ * @param context Not used.
+ */
+static void GOVERNOR__check(void* context)
+{
+    uint16_t idle = 0;
+
+    SuspendAllInterrupts();
+
+    // No change while a press holds full speed
+    if (GOVERNOR__holdMs > 0)
+    {
+        GOVERNOR__holdMs = (GOVERNOR__holdMs > RUNTIME_SAMPLE_MS) ? (GOVERNOR__holdMs - RUNTIME_SAMPLE_MS) : 0;
+    }
+    else if (RUNTIME_GetTaskLoad(tsk_background, &idle) == RC_SUCCESS)
+    {
+        // tsk_background is the idle task, the rest of the window was busy
+        uint16_t busy = (idle < 1000U) ? (1000U - idle) : 0U;
+
+        if ((busy < GOVERNOR_DOWN_PERMILLE) && ((GOVERNOR__level + 1U) < GOVERNOR__LEVELS))
+        {
+            GOVERNOR__target = GOVERNOR__level + 1U;
+        }
+        else if ((busy > GOVERNOR_UP_PERMILLE) && (GOVERNOR__level > GOVERNOR__FULL_SPEED))
+        {
+            GOVERNOR__target = GOVERNOR__level - 1U;
+        }
+    }
+
+    ResumeAllInterrupts();
+}
+
+/**
+ * @brief Switches the bus clock and rescales everything that counts CPU cycles.
+ *
+ * Runs at the start of a SysTick period. SYST_CVR cannot be rescaled (any
+ * write clears it), so the running period is restarted at the new clock,
+ * shortened by the time it had already run. Only the few cycles between the
+ * last read and the restart are lost.
+ *
+ * @param level Index into GOVERNOR__dividers.
+ */
+static void GOVERNOR__setLevel(uint8_t level)
+{
+    uint16_t oldDivider = GOVERNOR__dividers[GOVERNOR__level];
+    uint16_t divider = GOVERNOR__dividers[level];
+    uint32_t hz = BCLK__BUS_CLK__HZ / divider;
+    uint32_t reload = MILLISECONDS_TO_TICKS(1, hz) - 1U;
+
+    // PRIMASK, isr_buttons must not see the time base between the two dividers
+    uint8 state = CyEnterCriticalSection();
+
+    // A faster clock needs the flash wait states first, a slower one may drop them after
+    if (level < GOVERNOR__level)
+    {
+        CyFlash_SetWaitCycles((uint8)(hz / 1000000U));
+    }
+
+    // Elapsed part of the period in time base ticks: before and after the switch
+    uint32_t current = NVIC_ST_CURRENT_R;
+    uint32_t elapsed = (NVIC_ST_RELOAD_R - current) * oldDivider;
+    TIMEBASE_SetCpuDivider(divider);
+#ifdef EE_EXECUTION_BUDGET__
+    SetExecutionBudgetDivider(divider);
+#endif
+    CyBusClk_SetDivider(divider - 1U);
+    uint32_t restart = NVIC_ST_CURRENT_R;
+    elapsed += (current - restart) * divider;
+
+    // Restart the period with the remainder, the following ones are 1 ms again
+    NVIC_ST_RELOAD_R = reload - (elapsed / divider);
+    NVIC_ST_CURRENT_R = 0U;
+    while (NVIC_ST_CURRENT_R == 0U)
+    {
+    }
+    NVIC_ST_RELOAD_R = reload;
+    CyDelayFreq(hz);
+
+    if (level > GOVERNOR__level)
+    {
+        CyFlash_SetWaitCycles((uint8)(hz / 1000000U));
+    }
+    GOVERNOR__level = level;
+
+    CyExitCriticalSection(state);
+}
@@ -0,0 +1,153 @@
+/**
+* \file governor.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief CPU clock governor driven by the load of the runtime accounting
+*
+* Every RUNTIME_SAMPLE_MS the busy share of the runtime window is checked:
+* below GOVERNOR_DOWN_PERMILLE the bus clock is divided one level further,
+* above GOVERNOR_UP_PERMILLE it is raised one level. A button press raises it
+* to full speed with the next tick and holds it there for GOVERNOR_HOLD_MS.
+* Changes are applied by GOVERNOR_Tick() at a SysTick boundary, so the 1 ms
+* period and with it cnt_systick and the alarms keep their rate.
+*
+* Only the bus clock (CPU, SysTick, DWT) is divided, the master clock stays
+* at BCLK__BUS_CLK__HZ, so UART_Logs, Clock_PWM and Clock_Counter_RG keep
+* their frequencies. SysTick, the CyDelay calibration, the flash wait states
+* and the time base are rescaled with every change. Clock_PWM (12 MHz) is
+* synchronous to the bus clock, which limits the divider to 2. Execution
+* budgets (budget_cfg.h) stay counts of cycles, so they allow more time while
+* the clock is divided. The minimum inter-arrival times are times: the kernel
+* weights its cycles with the divider (SetExecutionBudgetDivider()) like the
+* time base. GOVERNOR_CLOCK_SCALING enables the governor, it is off by
+* default.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include "global.h"
+#include "ErikaOS_ee.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define GOVERNOR_CLOCK_SCALING      OFF     /**< ON: the bus clock follows the CPU load */
+
+#define GOVERNOR_DOWN_PERMILLE      200     /**< Busy share below which the clock is lowered [1/1000] */
+#define GOVERNOR_UP_PERMILLE        600     /**< Busy share above which the clock is raised [1/1000] */
+#define GOVERNOR_HOLD_MS            5000    /**< Full speed after a button press [ms] */
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class GOVERNOR
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the periodic load check at full speed.
+ *
+ * TIMEBASE_Init(), SWTIMER_Init() and RUNTIME_Init() must have been called before.
+ *
+ * @return RC_SUCCESS or the error of SWTIMER_Start()
+ */
+RC_t GOVERNOR_Init(void);
+
+/**
+ * @brief Raises the clock to full speed for GOVERNOR_HOLD_MS, called on a button press.
+ *
+ * May be called from any task or ISR2.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t GOVERNOR_Activity(void);
+
+/**
+ * @brief Applies a pending level change, first statement of systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t GOVERNOR_Tick(void);
+
+/**
+ * @brief Returns the current CPU clock.
+ *
+ * @param hz Pointer receiving the clock [Hz].
+ * @return RC_SUCCESS, RC_ERROR_NULL
+ */
+RC_t GOVERNOR_GetClock(uint32_t* hz);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* GOVERNOR_H */
@@ -0,0 +1,98 @@
+/**
+* \file hal_cfg.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Interrupt configuration of the ErikaOS Cortex-M HAL
+*
+* Picked up by ErikaOS_eecfg.inc, so this file may only contain
+* pre-processor definitions: no types, no prototypes, no includes.
+*
+* With EE_CORTEX_MX_KERNEL_BASEPRI the kernel critical sections raise BASEPRI
+* instead of setting PRIMASK. Only interrupts with a priority value at or
+* above the kernel level are masked (all ISR2s, SysTick, PendSV); the
+* interrupts above form a zero latency tier for category 1 ISRs, here the
+* button capture. Without the define the kernel masks globally as before.
+* Suspend/Disable(All|OS)Interrupts() then no longer protect data shared with
+* isr_buttons: the capture ring is lock free, the time base and the LATENCY
+* snapshots use PRIMASK (CyEnterCriticalSection()), any new shared data has to
+* do the same.
+*
+* Rescheduling at the end of an ISR2 always runs in the PendSV exception at
+* the lowest priority, so a burst of ISRs tail-chains into one context change.
+* With EE_CORTEX_MX_LAZY_PENDSV PendSV is only pended if a task preempts;
+* without it every outermost ISR2 ends with a PendSV exception.
+*
+* The ready queue, the end of an ISR2 and of a task, CounterTick, the context
+* change, systick_handler and isr_buttons are linked into .ramfunc. Whether they
+* run from SRAM without flash wait states or from flash is switched in the
+* custom linker script source/bsw/cm3gcc.ld, the assembler files cannot see
+* the defines of this file.
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef HAL_CFG_H
+#define HAL_CFG_H
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+/* CyIntSetPriority() levels, 0 is the most urgent one */
+#define HAL_PRIO_ZERO_LATENCY       0U          /**< Category 1 ISRs which the kernel never masks */
+#define HAL_PRIO_KERNEL             1U          /**< Most urgent level of the ISR2s */
+
+/* Comment out to mask with PRIMASK, e.g. for a latency comparison */
+#define EE_CORTEX_MX_KERNEL_BASEPRI (HAL_PRIO_KERNEL << 5)  /**< Raw NVIC value, 3 priority bits */
+
+/* Comment out to pend PendSV after every ISR2, e.g. for a latency comparison */
+#define EE_CORTEX_MX_LAZY_PENDSV
+
+#endif /* HAL_CFG_H */
@@ -0,0 +1,94 @@
+/**
+* \file hrcounter_cfg.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief High resolution counter configuration for the ErikaOS kernel
+*
+* Picked up by ErikaOS_eecfg.inc, so this file may only contain
+* pre-processor definitions: no types, no prototypes, no includes.
+*
+* cnt_hires counts the 1 MHz free running Counter_HiRes (32 bit UDB counter,
+* period EE_HR_COUNTER_MAXALLOWEDVALUE, interrupt on compare) in us. It has
+* no periodic tick, the compare is programmed one shot to the next expiry
+* and isr_hires (category 2) calls HrCounterTick(). The alarms listed in
+* EE_HR_COUNTER_ALARMS and sched_glower run on it instead of cnt_systick,
+* so they are no longer bound to the 1 ms tick.
+*
+* Counter_HiRes and isr_hires are not part of TopDesign yet: place them
+* and add isr_hires to the ISR list of the ErikaOS component before
+* enabling EE_HR_COUNTER__.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef HRCOUNTER_CFG_H
+#define HRCOUNTER_CFG_H
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+/* Uncomment once Counter_HiRes and isr_hires are placed */
+//#define EE_HR_COUNTER__
+
+#define HRCOUNTER_TICKS_PER_MS          1000U       /**< Counter_HiRes clock [kHz] */
+
+//####################### COUNTER
+
+#define cnt_hires                       EE_HR_COUNTER   /**< Appended after the customizer counters */
+
+#define EE_HR_COUNTER_MAXALLOWEDVALUE   0x7FFFFFFFU /**< Period of Counter_HiRes, 2^n - 1 (35 min) */
+#define EE_HR_COUNTER_TICKSPERBASE      1U
+#define EE_HR_COUNTER_MINCYCLE          1U
+
+/* Alarms moved from their customizer counter onto cnt_hires, one bit per alarm */
+#define EE_HR_COUNTER_ALARMS            (1U << alrm_seven)
+
+#endif /* HRCOUNTER_CFG_H */
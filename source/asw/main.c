@@ -11,6 +11,22 @@
 #include "project.h"
 #include "arcadian.h"
 #include "reactionGame.h"
+#include "capture.h"
+#include "latency.h"
+#include "runtime.h"
+#include "fsm.h"
+#include "prng.h"
+#include "cycle.h"
+#include "timebase.h"
+#include "swtimer.h"
+#include "delay.h"
+#include "replay.h"
+#include "bench.h"
+#include "hrtimer.h"
+#include "governor.h"
+#include "board.h"
+#include "report.h"
+#include <stdlib.h>
 
 
 /**
@@ -31,19 +47,196 @@ const RG__Glow_t RG_glowtable_1[] = {
     {10, 10, 10, 100}
 };
 
-Fader_t myFader;
-RGBGlower_t myRGBGlower;
+/* Application state of the board, only reached through RG__board */
+static Fader_t myFader;
+static RGBGlower_t myRGBGlower;
 static Game_t myGame;
 
+/** The board running on this device, its counter is cnt_systick */
+static BOARD_t RG__board;
+
+#define RG__PRESS_QUEUE_LENGTH      4       /**< Presses in flight between systick_handler and tsk_reactionGame */
+
+#ifdef EE_HR_COUNTER__
+#define RG__SEVEN_TICKS_PER_MS      HRCOUNTER_TICKS_PER_MS  /**< alrm_seven runs on cnt_hires */
+#else
+#define RG__SEVEN_TICKS_PER_MS      1U                      /**< alrm_seven runs on cnt_systick */
+#endif
+
+/* The benchmarks compare cycle counts, they run at a fixed clock */
+#if (GOVERNOR_CLOCK_SCALING == ON) && (LATENCY_BENCHMARK == OFF) && (BENCH_SUITE == OFF)
+#define RG__GOVERNOR                ON
+#else
+#define RG__GOVERNOR                OFF
+#endif
+
+/** Button presses of the running round, written by systick_handler */
+static REACTION_press_t RG__pressRecords[RG__PRESS_QUEUE_LENGTH];
+static MsgQType RG__pressQueue = STATICMSGQ(RG__pressRecords, sizeof(REACTION_press_t),
+                                            RG__PRESS_QUEUE_LENGTH, tsk_reactionGame);
+
+static void RG__flushPresses(void);
+static void RG__roundTimeout(void* context);
+static RC_t RG__nextPress(boolean_t playing, CAPTURE_event_t* capture);
+
+#if (REPLAY_MODE == REPLAY_PLAY)
+/** Inputs replayed instead of the live ones, rows as printed by a REPLAY_RECORD build */
+static const REPLAY_record_t RG__session[] = {
+#include "replay_session.inc"
+};
+#elif (REPLAY_MODE == REPLAY_RECORD)
+static void RG__printRecording(void);
+#endif
+
+/** Events of the game state machine, in the order they are dispatched after one wake up */
+typedef enum {
+    RG__EV_RESTART,         /**< Game over, start a new game */
+    RG__EV_SHOW_DIGIT,      /**< Random delay expired, show the digit */
+    RG__EV_PRESS,           /**< A press record was queued by systick_handler */
+    RG__EV_TIMEOUT,         /**< isr_timer: round duration expired */
+    RG__EVENTS
+} RG__event_t;
+
+#define RG__STATES      (None + 1)  /**< One transition table row per GameStates value */
+
+/** OS event(s) mapped to each RG__event_t */
+static const EventMaskType RG__eventMasks[] = {
+    ev_restart_game,
+    ev_start_calculation,
+    ev_stop_calc_correct | ev_stop_calc_incorrect,
+    ev_stop_calc_timeout
+};
+FSM_STATIC_ASSERT(sizeof(RG__eventMasks) / sizeof(RG__eventMasks[0]) == RG__EVENTS, rgEventMasks);
+
+static FSM_state_t RG__restart(FSM_state_t state, void* context);
+static FSM_state_t RG__startRound(FSM_state_t state, void* context);
+static FSM_state_t RG__showDigit(FSM_state_t state, void* context);
+static FSM_state_t RG__dropPresses(FSM_state_t state, void* context);
+static FSM_state_t RG__evaluatePress(FSM_state_t state, void* context);
+static FSM_state_t RG__timeout(FSM_state_t state, void* context);
+
+/** One table row, a row with a missing event does not compile */
+#define RG__ROW(restart, showDigit, press, timeout) \
+    {[RG__EV_RESTART] = (restart), [RG__EV_SHOW_DIGIT] = (showDigit), \
+     [RG__EV_PRESS] = (press), [RG__EV_TIMEOUT] = (timeout)}
+FSM_STATIC_ASSERT(RG__EVENTS == 4, rgRowArity);
+
+/** Transitions of the reaction game, one row per GameStates value */
+static const FSM_action_t RG__transitions[][RG__EVENTS] = {
+    /*                        restart      showDigit      press              timeout     */
+    [IsWaitingRoundStart]   = RG__ROW(RG__restart, FSM_IGNORE,    RG__startRound,    FSM_IGNORE),
+    [IsWaitingDisplay]      = RG__ROW(FSM_IGNORE,  RG__showDigit, RG__dropPresses,   FSM_IGNORE),
+    [IsWaitingUserReaction] = RG__ROW(FSM_IGNORE,  FSM_IGNORE,    RG__evaluatePress, RG__timeout),
+    [None]                  = RG__ROW(FSM_IGNORE,  FSM_IGNORE,    FSM_IGNORE,        FSM_IGNORE)
+};
+FSM_STATIC_ASSERT(FSM_ROWS(RG__transitions) == RG__STATES, rgTransitionRows);
+
+/** Game state machine, run by tsk_reactionGame */
+static FSM_t RG__gameFsm;
+/** Dispatches per transition table cell */
+static uint16_t RG__transitionCount[RG__STATES * RG__EVENTS];
+
+#if (RUNTIME_REPORT == ON)
+/** Names in the transition report, in the order of GameStates and RG__event_t */
+static const char_t* const RG__stateNames[RG__STATES] = {"RoundStart", "Display", "UserReaction", "None"};
+static const char_t* const RG__eventNames[RG__EVENTS] = {"restart", "showDigit", "press", "timeout"};
+#endif
+
+#if (LATENCY_BENCHMARK == ON) || (BENCH_SUITE == ON)
+#define RG__PROBE_EVENT             0x40U   /**< Wakes tsk_reactionGame without a game event, bit 6 is Event_7 of the customizer */
+
+/* The customizer assigns the event bits in order, Event_7 would share RG__PROBE_EVENT */
+#if (EE_MAX_EVENT > 6)
+#error "RG__PROBE_EVENT is Event_7 of the ErikaOS customizer, configure at most 6 events"
+#endif
+#endif
+#if (LATENCY_BENCHMARK == ON)
+#define RG__LATENCY_REPORT_ROUNDS   1000    /**< Triggers per ISR between two UART reports */
+#define RG__LATENCY_SECTION_US      10      /**< Kernel critical section the buttons trigger falls into */
+
+/* Signalling path measured by the signal probe */
+#if (LATENCY_SIGNAL_FROM_ISR == ON)
+#define RG__LATENCY_SET_EVENT(task, event)  SetEventFromISR(task, event)
+#else
+#define RG__LATENCY_SET_EVENT(task, event)  SetEvent(task, event)
+#endif
+
+/** Next software pended isr_timer wakes up tsk_reactionGame for the signal probe */
+static volatile boolean_t RG__latencySignal = FALSE;
+#endif
+
 /**
  * @brief SysTick interrupt service routine.
  *
  * This function is the interrupt service routine (ISR) for the SysTick timer.
- * The purpose of this ISR is to increment the 'cnt_systick' counter.
+ * The purpose of this ISR is to tick the board, which increments the
+ * 'cnt_systick' counter, and to keep the high word of the time base current.
+ * It also runs the deferred part of the button handling: every press captured
+ * by the category 1 isr_buttons since the last tick is checked against the
+ * display and handed to tsk_reactionGame as a record of RG__pressQueue, the
+ * capture is read straight into the record. Whether a press starts a round,
+ * is a reaction or is dropped is decided by the game state machine. While a
+ * session is replayed, its presses and timeouts are taken instead of the
+ * live inputs. Every press raises the bus clock to full speed, a pending
+ * clock change of the governor is applied at the start of the handler.
+ * Finally it advances the CPU load window of the runtime accounting.
+ * Linked into .ramfunc, executed from SRAM by default.
  */
-ISR(systick_handler)
+ISR2_RAMFUNC(systick_handler)
 {
+#if (LATENCY_BENCHMARK == ON)
+    LATENCY_EntrySysTick();
+#endif
+    RUNTIME_IsrEnter();
+#if (RG__GOVERNOR == ON)
+    /* Clock changes only at the start of a period */
+    GOVERNOR_Tick();
+#endif
+    TIMEBASE_Tick();
+    /* The board counter mirrors cnt_systick, the kernel keeps the alarms */
+    (void)BOARD_Tick(&RG__board);
+#if (BENCH_SUITE == ON)
+    /* Measured in place, with the alarms the game really has */
+    uint32_t start = CYCLE_NOW();
+    CounterTick(cnt_systick);
+    BENCH_NoteTick(CYCLE_SINCE(start));
+#else
     CounterTick(cnt_systick);
+#endif
+    REPLAY_Tick();
+    
+    boolean_t playing = REPLAY_IsPlaying();
+    
+    if (playing == TRUE){
+        /* Live presses are dropped, the session brings its own */
+        CAPTURE_event_t live;
+        while (CAPTURE_Get(&live) == RC_SUCCESS){
+        }
+    }
+    
+    REACTION_press_t* press = NULL;
+    while (ReserveMsgQ(&RG__pressQueue, (void**)&press) == E_OK){
+        
+        if (RG__nextPress(playing, &press->capture) != RC_SUCCESS){
+            CancelMsgQ(&RG__pressQueue);
+            break;
+        }
+        
+#if (RG__GOVERNOR == ON)
+        /* Full speed while the player is active */
+        GOVERNOR_Activity();
+#endif
+        
+        /* Reaction time is taken from the capture, not from now */
+        press->correct = REACTION_correctButtonPressed(press->capture.buttons);
+        CommitMsgQ(&RG__pressQueue, (press->correct == TRUE) ? ev_stop_calc_correct : ev_stop_calc_incorrect);
+    }
+    
+    RUNTIME_Tick();
+    RUNTIME_IsrExit(RUNTIME_ISR_SYSTICK);
+#if (LATENCY_BENCHMARK == ON)
+    LATENCY_Mark(LATENCY_DISPATCH);
+#endif
 }
 
 
@@ -58,16 +251,47 @@ ISR(systick_handler)
 
 TASK(tsk_auto){
     
-    /* Initialise Reaction Game and Arcadian */
+#if (REPLAY_MODE == REPLAY_RECORD)
+    REPLAY_Record();
+#elif (REPLAY_MODE == REPLAY_PLAY)
+    REPLAY_Play(RG__session, sizeof(RG__session) / sizeof(RG__session[0]));
+#endif
+    
+    /* Initialise the time base, the software timers and delays, Reaction Game and Arcadian */
+    TIMEBASE_Init();
+    SWTIMER_Init();
+    DELAY_Init();
+
+    /* The board must exist before the first tick of systick_handler */
+    BOARD_Create(&RG__board, &myGame, &myFader, &myRGBGlower,
+                 OSMAXALLOWEDVALUE_cnt_systick, OSTICKSPERBASE_cnt_systick, NULL);
 
-    ARCADIAN_init(&myFader, &myRGBGlower);
-    REACTION_init(&myGame);
+    ARCADIAN_init(RG__board.fader, RG__board.glower);
+    REACTION_init(RG__board.game, RG__roundTimeout);
+    FSM_Init(&RG__gameFsm, &RG__transitions[0][0], RG__STATES, RG__EVENTS,
+             IsWaitingRoundStart, RG__board.game, RG__transitionCount);
+    RUNTIME_Init();
+#if (LATENCY_BENCHMARK == ON)
+    LATENCY_Init();
+#endif
+#ifdef EE_HR_COUNTER__
+    HRTIMER_Init();
+#endif
+#if (RG__GOVERNOR == ON)
+    GOVERNOR_Init();
+#endif
         
     /* Reconfigure ISRs with OS parameters.
      * This line MUST be called after the hardware driver initialization!
      */
     EE_system_init();
     
+#ifdef EE_CORTEX_MX_KERNEL_BASEPRI
+    /* The customizer only offers the levels of the ISR2s, a regeneration
+     * would move the button capture back under the kernel level */
+    CyIntSetPriority(isr_buttons__INTC_NUMBER, HAL_PRIO_ZERO_LATENCY);
+#endif
+    
     /* Must be started after interrupt reconfiguration */
     EE_systick_start();
     
@@ -79,7 +303,9 @@ TASK(tsk_auto){
     
     /* Start the alarm with a 1ms cycle time */
     SetRelAlarm(alrm_fader ,100,1);
-    SetRelAlarm(alrm_glower ,100,0);
+    
+    /* Start the RGB choreography, one expiry point per glow table step */
+    StartScheduleTableRel(sched_glower, 100 * SCHEDTAB_TICKS_PER_MS);
     /* Terminate this task after initialization */
     TerminateTask();
 }
@@ -92,33 +318,38 @@ TASK(tsk_auto){
  * predefined table (RG_glowtable_1).
  */
 TASK(tsk_fader){
+#if (LATENCY_BENCHMARK == ON)
+    LATENCY_Entry(LATENCY_DISPATCH);
+#endif
+    Fader_t* fader = RG__board.fader;
+    
     /* Fader Implementation */
     /* Pattern one */
 
-    if (myFader.loopNumber == 0){
+    if (fader->loopNumber == 0){
         ARCADIAN_changeIntensityBy(Led_Red, -1);
         ARCADIAN_changeIntensityBy(Led_Yellow, 1);
-        ++myFader.faderCounter;
+        ++fader->faderCounter;
     }
     
     /* Pattern two */
-    else if (myFader.loopNumber == 1){
+    else if (fader->loopNumber == 1){
         ARCADIAN_changeIntensityBy(Led_Yellow, -1);
         ARCADIAN_changeIntensityBy(Led_Green, 1);  
-        ++myFader.faderCounter;
+        ++fader->faderCounter;
     }
     
     /* Pattern three */
-    else if (myFader.loopNumber == 2){
+    else if (fader->loopNumber == 2){
         ARCADIAN_changeIntensityBy(Led_Green, -1);
         ARCADIAN_changeIntensityBy(Led_Red, 1);
-        ++myFader.faderCounter;
+        ++fader->faderCounter;
     }
     
     /* Go to the next loop */
-    if (myFader.faderCounter == 255){
-        myFader.faderCounter = 0;
-        myFader.loopNumber = (myFader.loopNumber + 1) % 3;
+    if (fader->faderCounter == 255){
+        fader->faderCounter = 0;
+        fader->loopNumber = (fader->loopNumber + 1) % 3;
         
     } 
     else {
@@ -128,20 +359,25 @@ TASK(tsk_fader){
     TerminateTask();
 }
 
+/**
+ * @brief Task function for the RGB glow pattern.
+ *
+ * Activated by every expiry point of sched_glower (see schedtab_cfg.h), which
+ * holds the step timing of RG_glowtable_1. The task only applies the colour
+ * of the current step.
+ */
 TASK(tsk_glower){    
+    RGBGlower_t* glower = RG__board.glower;
+    
     /* RGB Implementation */ 
     
     /* Change RGB intensity */ 
-    ARCADIAN_changeIntensityTo(Led_RGB_Red, RG_glowtable_1[myRGBGlower.currentPositionRGB].redValue);
-    ARCADIAN_changeIntensityTo(Led_RGB_Green, RG_glowtable_1[myRGBGlower.currentPositionRGB].greenValue);
-    ARCADIAN_changeIntensityTo(Led_RGB_Blue, RG_glowtable_1[myRGBGlower.currentPositionRGB].blueValue);
-    
-    /* Trigger alarm for next change */ 
-    uint16_t nextTrigger = RG_glowtable_1[myRGBGlower.currentPositionRGB].timeInMS; 
-    SetRelAlarm(alrm_glower, nextTrigger, 0);
+    ARCADIAN_changeIntensityTo(Led_RGB_Red, RG_glowtable_1[glower->currentPositionRGB].redValue);
+    ARCADIAN_changeIntensityTo(Led_RGB_Green, RG_glowtable_1[glower->currentPositionRGB].greenValue);
+    ARCADIAN_changeIntensityTo(Led_RGB_Blue, RG_glowtable_1[glower->currentPositionRGB].blueValue);
     
     /* Change current position to next one*/ 
-    myRGBGlower.currentPositionRGB = (myRGBGlower.currentPositionRGB + 1) % 
+    glower->currentPositionRGB = (glower->currentPositionRGB + 1) % 
         (sizeof(RG_glowtable_1) / sizeof(RG_glowtable_1[0]));
 
     /* Terminate this task */        
@@ -151,113 +387,273 @@ TASK(tsk_glower){
 /**
  * @brief Task function for handling the Reaction Game events.
  *
- * This task manages the different states of the reaction game, such as
- * waiting for the round to start, waiting for the user's reaction, and handling
- * correct/incorrect responses and timeouts.
+ * This task waits for the events of the reaction game and dispatches each of
+ * them to the game state machine (RG__transitions), which runs the action of
+ * the current state, such as starting a round, evaluating the user's reaction
+ * or handling a timeout.
  */
 
 TASK(tsk_reactionGame){
     
     EventMaskType ev = 0;
+    EventMaskType wait = ev_start_calculation | ev_stop_calc_correct | ev_stop_calc_incorrect | ev_stop_calc_timeout | ev_restart_game;
     
+#if (LATENCY_BENCHMARK == ON) || (BENCH_SUITE == ON)
+    wait |= RG__PROBE_EVENT;
+#endif
     while (1){
-        WaitEvent(ev_start_round | ev_start_calculation | ev_stop_calc_correct | ev_stop_calc_incorrect | ev_stop_calc_timeout | ev_restart_game);
+        WaitEvent(wait);
+#if (LATENCY_BENCHMARK == ON)
+        /* Woken up by the signal probe, RG__PROBE_EVENT is dropped below */
+        LATENCY_Entry(LATENCY_SIGNAL);
+#endif
         GetEvent(tsk_reactionGame, &ev);
         ClearEvent(ev); 
         
-        if (ev & ev_start_round){
-            /* if round number is greater than max round, display game details
-            *  and set an event to reset the game
-            */    
-            if (myGame.roundNumber > myGame.maxRounds){
-     
-                REACTION_displayDetails(&myGame);
-                SetEvent(tsk_reactionGame, ev_restart_game);
-            }
-            
-            /* if round number is less than max round, prints the round number,
-            * generates a random number, and sets the game state to wait for diplay
-            * to show a number
-            */
-            else {
-
-                //printRoundNumber();
-                REACTION_printRoundNumber(myGame.roundNumber);
-                
-                // generate random time     
-                uint16_t randomNumber = 0;
-                REACTION_generateRandomNum(&randomNumber, 3);
-                
-                // trigger the alarm after random seconds                
-                SetRelAlarm(alrm_seven, randomNumber*1000, 0);
-                myGame.gameState = IsWaitingDisplay;
+        /* Events ignored in the current state are dropped */
+        for (uint8_t event = 0; event < RG__EVENTS; ++event){
+            if (ev & RG__eventMasks[event]){
+                FSM_Dispatch(&RG__gameFsm, event);
             }
+        }
+    }    
+    TerminateTask();
+}
+
+/**
+ * @brief Resets the game after the last round.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return IsWaitingRoundStart.
+ */
+static FSM_state_t RG__restart(FSM_state_t state, void* context){
+    
+    REACTION_resetGame((Game_t*)context);
+    
+    return IsWaitingRoundStart;
+}
 
-        } 
+/**
+ * @brief Starts a round on a button press.
+ *
+ * If the round number is greater than max round, displays the game details and
+ * sets an event to reset the game. Otherwise prints the round number and
+ * starts the alarm showing the digit after a random delay.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return IsWaitingDisplay, or state if the game is over.
+ */
+static FSM_state_t RG__startRound(FSM_state_t state, void* context){
+    
+    Game_t* game = (Game_t*)context;
+    
+    /* Only the press itself was of interest, its timing is a source of entropy */
+    RG__flushPresses();
+    uint32_t sample = CYCLE_NOW();
+    REPLAY_Value(REPLAY_ENTROPY, &sample);
+    PRNG_AddEntropy(sample);
+    
+    if (game->roundNumber > game->maxRounds){
+        REACTION_displayDetails(game);
+#if (REPLAY_MODE == REPLAY_RECORD)
+        RG__printRecording();
+#endif
+        SetEvent(tsk_reactionGame, ev_restart_game);
         
-        else if (ev & ev_restart_game){
-            REACTION_resetGame(&myGame);    
-        }
+        return state;
+    }
+    
+    REACTION_printRoundNumber(game->roundNumber);
+    
+    // generate random time     
+    uint16_t randomNumber = 0;
+    REACTION_generateRandomNum(&randomNumber, REACTION_DELAY_MAX_SEC);
+    
+    // trigger the alarm after random seconds                
+    SetRelAlarm(alrm_seven, randomNumber * 1000 * RG__SEVEN_TICKS_PER_MS, 0);
+    
+    return IsWaitingDisplay;
+}
+
+/**
+ * @brief Shows a random digit and starts the reaction counter.
+ *
+ * Generates a random number and shows it on the 7 segment display. Once the
+ * display is on, starts the round timer for a maximum of durationOfRoundSec
+ * and the round time against which the presses are timestamped.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return IsWaitingUserReaction.
+ */
+static FSM_state_t RG__showDigit(FSM_state_t state, void* context){
+    
+    uint16_t randomNumberDisplay = 0;
+    REACTION_generateRandomNum(&randomNumberDisplay, 2);
+    REACTION_setDisplay(randomNumberDisplay);
+    REACTION_startRoundTimer((Game_t*)context);
+    /* Presses of earlier rounds must not be taken for this one */
+    RG__flushPresses();
+    
+    return IsWaitingUserReaction;
+}
+
+/**
+ * @brief Drops presses made before the digit is shown.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return state.
+ */
+static FSM_state_t RG__dropPresses(FSM_state_t state, void* context){
+    
+    RG__flushPresses();
+    
+    return state;
+}
+
+/**
+ * @brief Evaluates the user's reaction.
+ *
+ * The first press of the round decides, its record carries the button check
+ * and the time since the round start taken at the press. A correct press adds the reaction
+ * time to the game statistics and displays a success message, an incorrect one a
+ * failure message. Further presses of this round are dropped.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return IsWaitingRoundStart, or state if no record was queued.
+ */
+static FSM_state_t RG__evaluatePress(FSM_state_t state, void* context){
+    
+    Game_t* game = (Game_t*)context;
+    REACTION_press_t* press = NULL;
+    
+    if (ReceiveMsgQ(&RG__pressQueue, (void**)&press) != E_OK){
+        return state;
+    }
+    
+    REACTION_stopRoundTimer(game);
+    if (press->correct == TRUE){
+        uint16 reactionTime = 0;
+        REACTION_getReactionTimeMS(&reactionTime, game, press->capture.timestamp);
+        STATS_Add(&game->reactionTimes, reactionTime);
+        REACTION_resetDisplay();
+        REACTION_displaySuccessMessage(reactionTime);
+    }
+    else {
+        REACTION_resetDisplay();            
+        REACTION_displayFailureMessage();            
+    }
+    ReleaseMsgQ(&RG__pressQueue);
+    
+    ++game->roundNumber;
+    RG__flushPresses();
+    
+    return IsWaitingRoundStart;
+}
+
+/**
+ * @brief Ends a round without reaction.
+ *
+ * Stops the round timer, displays a timeout message and increments the number of rounds.
+ *
+ * @param state Current state.
+ * @param context Game_t of the game.
+ * @return IsWaitingRoundStart.
+ */
+static FSM_state_t RG__timeout(FSM_state_t state, void* context){
+    
+    REACTION_stopRoundTimer((Game_t*)context);
+    REACTION_resetDisplay();            
+    REACTION_displayTimeoutMessage();            
+    ++((Game_t*)context)->roundNumber; 
+    
+    return IsWaitingRoundStart;
+}
+
+/**
+ * @brief Drops all presses queued for tsk_reactionGame.
+ */
+static void RG__flushPresses(void){
+    
+    REACTION_press_t* press = NULL;
+    
+    while (ReceiveMsgQ(&RG__pressQueue, (void**)&press) == E_OK){
+        ReleaseMsgQ(&RG__pressQueue);
+    }
+}
+
+/**
+ * @brief Takes the next press for systick_handler.
+ *
+ * Live presses come from the capture buffer and are recorded. While a
+ * session is replayed, its due stimuli are taken instead, timeouts are
+ * raised on the way.
+ *
+ * @param playing REPLAY_IsPlaying().
+ * @param capture Pointer receiving the press.
+ * @return RC_SUCCESS or RC_ERROR_BUFFER_EMTPY if no press is pending.
+ */
+static RC_t RG__nextPress(boolean_t playing, CAPTURE_event_t* capture){
+    
+    if (playing == FALSE){
+        RC_t rc = CAPTURE_Get(capture);
         
-        else if (ev & ev_start_calculation){
-            /* Generates a random number and shows on the 
-            * 7 segment display. Once the disply is on, starts another counter 
-            * for a maximum of 1 second, which which be used to calculate the reaction
-            * time of the user
-            */
-            
-            //REACTION_stopCounter();
-            uint16_t randomNumberDisplay = 0;
-            REACTION_generateRandomNum(&randomNumberDisplay, 2);
-            REACTION_setDisplay(randomNumberDisplay);
-            REACTION_startCounterForTime(myGame.durationOfRoundSec);
-            myGame.gameState = IsWaitingUserReaction;
-     
-        }
-        else if (ev & ev_stop_calc_correct){
-            /* Stops the counter and calculates the rection time in seconds,
-            * adds the current reaction time to total time, increments number of 
-            * correct button presses, displays a success message, and increments 
-            * the number of rounds
-            */
-            uint16 reactionTime = 0;
-            REACTION_getReactionTimeMS(&reactionTime, myGame);
-            myGame.totalTime += reactionTime;
-            REACTION_resetDisplay();
-            ++myGame.correctPresses;
-            REACTION_displaySuccessMessage(reactionTime);
-            myGame.gameState = IsWaitingRoundStart;
-            ++myGame.roundNumber;
+        if (rc == RC_SUCCESS){
+            REPLAY_Stimulus(REPLAY_BUTTON, capture);
         }
-        
-        else if (ev & ev_stop_calc_incorrect){
-            /* Stops the counter and calculates the rection time in seconds,
-            * adds the current reaction time to total time, displays a failure
-            * message, and increments the number of rounds
-            */
-            //uint16 reactionTime = 0;
-            //REACTION_getReactionTimeMS(&reactionTime);            
-            REACTION_resetDisplay();            
-            REACTION_displayFailureMessage();            
-            myGame.gameState = IsWaitingRoundStart;
-            ++myGame.roundNumber;            
+        return rc;
+    }
+    
+    REPLAY_kind_t kind = REPLAY_BUTTON;
+    
+    while (REPLAY_GetStimulus(&kind, capture) == RC_SUCCESS){
+        if (kind == REPLAY_BUTTON){
+            return RC_SUCCESS;
         }
-        
-        else if (ev & ev_stop_calc_timeout){
-            /* Stops the counter and displays a timeout
-            * message, and increments the number of rounds
-            */
-            REACTION_stopCounter();            
-            REACTION_resetDisplay();            
-            REACTION_displayTimeoutMessage();            
-            myGame.gameState = IsWaitingRoundStart;            
-            ++myGame.roundNumber; 
-            
-        }        
-    }    
-    TerminateTask();
+        SetEventFromISR(tsk_reactionGame, ev_stop_calc_timeout);
+    }
+    
+    return RC_ERROR_BUFFER_EMTPY;
 }
 
+#if (REPLAY_MODE == REPLAY_RECORD)
+/**
+ * @brief Prints the inputs recorded since power up on UART.
+ *
+ * Every record is one C initialiser row, the block can be pasted into
+ * replay_session.inc to replay the session with REPLAY_MODE REPLAY_PLAY.
+ */
+static void RG__printRecording(void){
+    
+    static const char_t* const kinds[] = {"REPLAY_SEED", "REPLAY_ENTROPY", "REPLAY_BUTTON", "REPLAY_TIMEOUT"};
+    char_t buffer[11];
+    REPLAY_record_t record;
+    uint16_t records = 0;
+    uint16_t dropped = 0;
+    
+    REPLAY_GetCount(&records, &dropped);
+    UART_Logs_PutString("\n/* Replay session, ");
+    UART_Logs_PutString(utoa(dropped, buffer, 10));
+    UART_Logs_PutString(" inputs dropped */\n");
+    for (uint16_t i = 0; i < records; ++i){
+        if (REPLAY_GetRecord(i, &record) == RC_SUCCESS){
+            UART_Logs_PutString("{");
+            UART_Logs_PutString(utoa(record.value, buffer, 10));
+            UART_Logs_PutString("u, ");
+            UART_Logs_PutString(utoa(record.timestamp, buffer, 10));
+            UART_Logs_PutString("u, ");
+            UART_Logs_PutString(utoa(record.buttons, buffer, 10));
+            UART_Logs_PutString("u, ");
+            UART_Logs_PutString(kinds[record.kind]);
+            UART_Logs_PutString("},\n");
+        }
+    }
+}
+#endif
 
 /**
  * This task sets the event to display a random number on 7-segment display
@@ -269,46 +665,169 @@ TASK(tsk_sevenSegment){
 }
 
 /**
- * This ISR is triggered when a button is pressed. It checks the current
- * state of the reaction game and sets events accordingly, such as starting
- * a new round or indicating correct/incorrect user reactions.
+ * This category 1 ISR is triggered when a button is pressed. It bypasses the
+ * ISR2 prologue/epilogue of the kernel and only records the round time and
+ * the button pins, the game logic is deferred to systick_handler.
+ * No OS service may be called here. Linked into .ramfunc, executed from SRAM
+ * by default.
  */
-ISR2(isr_buttons){
-    
+ISR1_RAMFUNC(isr_buttons){
     
-    if (myGame.gameState == IsWaitingRoundStart){
-        SetEvent(tsk_reactionGame, ev_start_round);
+#if (LATENCY_BENCHMARK == ON)
+    /* Software pended by the benchmark, not a button press */
+    if (LATENCY_Entry(LATENCY_BUTTONS) == RC_SUCCESS){
+        return;
     }
+#endif
+    CAPTURE_Record();
+}
+
+/**
+ * @brief Round timer callback, called from isr_timer.
+ *
+ * The timeout is ignored by the game state machine unless a reaction is
+ * awaited. While a session is replayed, systick_handler raises its timeouts
+ * instead.
+ *
+ * @param context Game_t of the game.
+ */
+static void RG__roundTimeout(void* context){
     
-    else if (myGame.gameState == IsWaitingUserReaction){
-        if (REACTION_correctButtonPressed() == TRUE){
-            SetEvent(tsk_reactionGame, ev_stop_calc_correct);
-        } else {
-            SetEvent(tsk_reactionGame, ev_stop_calc_incorrect);
-        }
+    if (REPLAY_IsPlaying() == FALSE){
+        REPLAY_Stimulus(REPLAY_TIMEOUT, NULL);
+        SetEventFromISR(tsk_reactionGame, ev_stop_calc_timeout);
     }
-
 }
+
 /**
- * This ISR is triggered when the timer count reaches 0
+ * This ISR is triggered when the Counter reaches 0, it runs the callbacks
+ * of all due software timers and programs the Counter for the next one.
  */
 ISR2(isr_timer){
     
-    if (myGame.gameState == IsWaitingUserReaction){
-        SetEvent(tsk_reactionGame, ev_stop_calc_timeout);
+#if (LATENCY_BENCHMARK == ON)
+    /* Software pended by the benchmark, not a timeout */
+    if (LATENCY_Entry(LATENCY_TIMER) == RC_SUCCESS){
+        if (RG__latencySignal == TRUE){
+            LATENCY_Mark(LATENCY_SIGNAL);
+            RG__LATENCY_SET_EVENT(tsk_reactionGame, RG__PROBE_EVENT);
+            RG__latencySignal = FALSE;
+        } else {
+            LATENCY_Mark(LATENCY_RETURN);
+        }
+        return;
     }
-    
+#endif
+    RUNTIME_IsrEnter();
+#if (BENCH_SUITE == ON)
+    uint32_t start = CYCLE_NOW();
+    uint8_t expired = 0;
+    SWTIMER_Expire(&expired);
+    BENCH_NoteExpire(CYCLE_SINCE(start), expired);
+#else
+    SWTIMER_Expire(NULL);
+#endif
+    RUNTIME_IsrExit(RUNTIME_ISR_TIMER);
+}
 
+#ifdef EE_HR_COUNTER__
+/**
+ * This ISR is triggered by the compare match of Counter_HiRes, the kernel
+ * processes the expired alarms of cnt_hires and programs the next compare.
+ */
+ISR2(isr_hires){
+    
+    HRTIMER_Acknowledge();
+    HrCounterTick();
 }
+#endif
 
 /**
  * @brief Background task function.
  *
  * This task is designed to run indefinitely, serving as a background task.
+ * With LATENCY_BENCHMARK it pends isr_buttons and isr_timer at varying phases
+ * against the 1 ms load of the other tasks and reports the entry latencies.
+ * isr_buttons is pended from within a kernel critical section, so building
+ * with and without EE_CORTEX_MX_KERNEL_BASEPRI compares both masking modes.
+ * The way back from isr_timer and from systick_handler into a task is measured
+ * as well, building with and without EE_CORTEX_MX_LAZY_PENDSV compares both
+ * ways of scheduling at the end of an ISR2, linking .ramfunc into flash or
+ * into SRAM (source/bsw/cm3gcc.ld) compares the hot paths in both memories.
+ * Every other trigger of isr_timer wakes up tsk_reactionGame with an event,
+ * building with and without LATENCY_SIGNAL_FROM_ISR compares SetEvent() and
+ * SetEventFromISR() from the ISR2 entry until the task resumes.
+ * With BENCH_SUITE it measures the cost of kernel services and BSW drivers
+ * and of the software timers over the number of active timers while the
+ * game keeps running.
+ * Otherwise it is the idle task and reports the CPU load with RUNTIME_REPORT.
+ * As a basic task it cannot wait for an event, DELAY_MS spins in it instead,
+ * which is idle time as well.
  */
 TASK(tsk_background){
     
-    while (1){}
+#if (LATENCY_BENCHMARK == ON)
+    uint16_t round = 0;
+    
+    while (1){
+        /* Spread the trigger points over the systick period */
+        DELAY_US(101 + (round * 37) % 800);
+        /* Pended inside a kernel critical section: delayed by the whole
+         * section with PRIMASK masking, not at all with BASEPRI masking */
+        SuspendOSInterrupts();
+        LATENCY_Trigger(LATENCY_BUTTONS, isr_buttons__INTC_NUMBER);
+        DELAY_US(RG__LATENCY_SECTION_US);
+        ResumeOSInterrupts();
+        DELAY_US(53 + (round * 59) % 700);
+        if (LATENCY_Trigger(LATENCY_TIMER, isr_timer__INTC_NUMBER) == RC_SUCCESS){
+            /* Back from isr_timer, nothing was activated */
+            while (LATENCY_Entry(LATENCY_RETURN) != RC_SUCCESS){
+            }
+        }
+        DELAY_US(71 + (round * 43) % 700);
+        RG__latencySignal = TRUE;
+        if (LATENCY_Trigger(LATENCY_TIMER, isr_timer__INTC_NUMBER) == RC_SUCCESS){
+            /* isr_timer wakes up tsk_reactionGame, which runs before this task continues */
+            while (RG__latencySignal == TRUE){
+            }
+        }
+        RG__latencySignal = FALSE;
+        
+        if (++round == RG__LATENCY_REPORT_ROUNDS){
+            round = 0;
+            REPORT_Latency();
+        }
+    }
+#elif (BENCH_SUITE == ON)
+    BENCH_SuiteInit(tsk_reactionGame, ev_start_round, RG__PROBE_EVENT);
+    
+    while (1){
+        DELAY_MS(BENCH_SUITE_PERIOD_MS);
+        BENCH_SuiteReport();
+    }
+#else
+#if (RUNTIME_REPORT == ON)
+    uint32_t report = TIMEBASE_Now32();
+#endif
+    while (1){
+#if (RUNTIME_REPORT == ON)
+        /* Idle until the next report. Paced by the time base, so neither the
+         * governor nor the time spent in the report shifts the period. Polled
+         * lock free, the idle loop must not show up in the critical sections */
+        report += (uint32_t)RUNTIME_REPORT_MS * TIMEBASE_CYCLES_PER_MS;
+        while ((sint32_t)(TIMEBASE_Now32() - report) < 0){
+        }
+        REPORT_Runtime();
+        REPORT_Transitions(&RG__gameFsm, RG__stateNames, RG__eventNames);
+#ifdef EE_EXECUTION_BUDGET__
+        REPORT_Budgets();
+#endif
+#ifdef EE_CS_PROFILE__
+        REPORT_CriticalSections();
+#endif
+#endif
+    }
+#endif
     TerminateTask();
 }
 
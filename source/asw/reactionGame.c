@@ -22,14 +22,18 @@
 /* Include files                                                             */
 /*****************************************************************************/
 
-#include <time.h>
 #include <stdlib.h>
 
 #include "project.h"
 #include "reactionGame.h"
 #include "seven.h"
 #include "button.h"
-#include "Counter.h"
+#include "capture.h"
+#include "cycle.h"
+#include "timebase.h"
+#include "prng.h"
+#include "fmt.h"
+#include "replay.h"
 /*****************************************************************************/
 /* Local pre-processor symbols/macros ('#define')                            */
 /*****************************************************************************/
@@ -46,15 +50,12 @@
 /* Local variable definitions ('static')                                     */
 /*****************************************************************************/
 
-/**
- * @brief Variable representing the clock frequency for the reaction game module.
- */
-static uint16_t countInOneSec = 12000;
-
 /*****************************************************************************/
 /* Local function prototypes ('static')                                      */
 /*****************************************************************************/
 
+static void REACTION__printNumber(uint32_t number);
+
 
 /*****************************************************************************/
 /* Function implementation - global ('extern') and local ('static')          */
@@ -65,30 +66,34 @@ static uint16_t countInOneSec = 12000;
  *
  * This function initializes the Reaction Game module by performing the following steps:
  * - Initializing UART communication.
- * - Starting the clock counter for the Reaction Game.
- * - Seeding the random number generator.
- * - Setting initial values for the game state, maximum rounds, and round duration.
+ * - Setting up the round timer.
+ * - Seeding the random number generator from the cycle counter.
+ * - Setting initial values for the maximum rounds and round duration.
  * - Displaying a welcome message on the UART.
- * - Setting the game state to waiting for the start of a new round.
  * - Setting the initial round number to 1.
  *
  * @param game Pointer to the Game_t structure.
+ * @param timeout Called from isr_timer when a round ends without reaction.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_init(Game_t *game) {
+RC_t REACTION_init(Game_t *game, SWTIMER_callback_t timeout) {
     /* Initialize UART communication. */
     UART_Logs_Start();
 
-    /* Start the clock counter for the Reaction Game. */
-    Clock_Counter_RG_Start();
+    /* Set up the round timer, SWTIMER_Init() has started the Counter. */
+    SWTIMER_Create(&game->roundTimer, timeout, game);
 
-    /* Seed the random number generator. */
-    srand(time(NULL));
+    /* Seed the random number generator, the button presses add entropy later on.
+     * A replayed session brings its own seed. */
+    CYCLE_Init();
+    uint32_t seed = CYCLE_NOW();
+    REPLAY_Value(REPLAY_SEED, &seed);
+    PRNG_Init(seed);
 
-    /* Set initial values for game state, maximum rounds, and round duration. */
-    game->gameState = None;
-    game->maxRounds = 10;
-    game->durationOfRoundSec = 1;
+    /* Set initial values for maximum rounds and round duration, no reaction times yet. */
+    game->maxRounds = REACTION_MAX_ROUNDS;
+    game->durationOfRoundSec = REACTION_ROUND_DURATION_SEC;
+    STATS_Reset(&game->reactionTimes);
 
     /* Display welcome message on UART. */
     UART_Logs_PutString("\nWelcome to the Reaction Game\n");
@@ -96,8 +101,6 @@ RC_t REACTION_init(Game_t *game) {
 
     UART_Logs_PutString("Press any key to begin\n\n");
 
-    /* Set the game state to waiting for the start of a new round. */
-    game->gameState = IsWaitingRoundStart;
     /* Set the initial round number to 1. */
     game->roundNumber = 1;
 
@@ -108,8 +111,7 @@ RC_t REACTION_init(Game_t *game) {
  * @brief Resets the game state for playing again.
  *
  * This function resets the game state to prepare for playing again. It displays a
- * message on UART, resets the round number, total time, correct presses, and sets
- * the game state to waiting for the start of a new round.
+ * message on UART, resets the round number, total time and correct presses.
  *
  * @param game Pointer to the Game_t structure containing game details.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
@@ -121,10 +123,8 @@ RC_t REACTION_resetGame(Game_t *game) {
 
     /* Reset game parameters. */
     game->roundNumber = 1;
-    game->maxRounds = 10;
-    game->totalTime = 0;
-    game->correctPresses = 0;
-    game->gameState = IsWaitingRoundStart;
+    game->maxRounds = REACTION_MAX_ROUNDS;
+    STATS_Reset(&game->reactionTimes);
     
     return RC_SUCCESS;
 }
@@ -132,47 +132,46 @@ RC_t REACTION_resetGame(Game_t *game) {
 /**
  * @brief Generates a random number within a specified limit.
  *
- * This function generates a random number within the specified limit and
- * returns it through the provided pointer.
+ * This function generates a uniformly distributed random number within the
+ * specified limit and returns it through the provided pointer.
  *
- * @param randomNumber Pointer to the variable where the random number will be stored.
- * @param limit The upper limit for the random number (exclusive).
+ * @param randomNumber Pointer to the variable where the random number will be stored, range 1...limit.
+ * @param limit The upper limit for the random number (inclusive), valid range 1...255.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
 RC_t REACTION_generateRandomNum(uint16_t *randomNumber, uint8_t limit) {
+    if (randomNumber == NULL) {
+        return RC_ERROR_NULL;
+    }
+
     /**
-     * Generate a random number using the rand() function.
-     * The generated number is within the range [1, limit].
+     * Generate an unbiased random number within the range [1, limit].
      */
-    *randomNumber = rand() % limit + 1;
+    uint32_t value = 0;
+    RC_t rc = PRNG_Range(limit, &value);
 
-    return RC_SUCCESS;
+    if (rc == RC_SUCCESS) {
+        *randomNumber = (uint16_t)(value + 1);
+    }
+
+    return rc;
 }
 
 /**
- * @brief Starts a counter for a specified duration.
+ * @brief Starts the round timer for the duration of a round.
  *
- * This function starts a counter for a duration specified by the provided random number,
- * which is multiplied by the global RGClockFrequency. The counter is configured to
- * stop after reaching the specified count.
+ * This function starts the one shot round timeout and takes the start of the round
+ * against which the button presses are timestamped.
  *
- * @param randomNumber The random number used to calculate the counter duration.
+ * @param game Pointer to the game data.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_startCounterForTime(uint16_t time) {
-    /**
-     * Multiply the required time by the global RGClockFrequency.
-     * This calculation determines the count needed for the specified duration.
-     */
-    time = time * countInOneSec;
+RC_t REACTION_startRoundTimer(Game_t *game) {
+    /* The presses of the round are timestamped against the time base. */
+    CAPTURE_StartRound(TIMEBASE_Now());
 
-    /* Start the counter, stop it, set the counter value, and start it again. */
-    Counter_Start();
-    Counter_Stop();
-    Counter_WriteCounter(time);
-    Counter_Start();
-
-    return RC_SUCCESS;
+    /* One shot, the timer shares the Counter with all other software timers. */
+    return SWTIMER_Start(&game->roundTimer, (uint32_t)game->durationOfRoundSec * 1000U, 0);
 }
 
 /**
@@ -185,22 +184,35 @@ RC_t REACTION_startCounterForTime(uint16_t time) {
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
 RC_t REACTION_displayDetails(const Game_t *game) {
+    STATS_summary_t summary = {0};
+    RC_t rc = STATS_GetSummary(&game->reactionTimes, &summary);
+
     /* Display correct presses on UART. */
     UART_Logs_PutString("\nCorrect presses : ");
-    char_t buffer[4];
-    REACTION_convertToString(game->correctPresses, buffer);
-    UART_Logs_PutString(buffer);
-
-    /* Display total time on UART. */
-    UART_Logs_PutString("\nTotal time : ");
-    REACTION_convertToString(game->totalTime, buffer);
-    UART_Logs_PutString(buffer);
+    REACTION__printNumber(summary.count);
 
+    /* Without a correct press there are no reaction times. */
+    if (rc != RC_SUCCESS) {
+        UART_Logs_PutString("\n");
+        return RC_SUCCESS;
+    }
 
-    /* Display average time on UART. */
+    /* Display mean and spread of the reaction times in ms on UART. */
     UART_Logs_PutString("\nAverage time : ");
-    REACTION_convertToString(game->totalTime / game->correctPresses, buffer);
-    UART_Logs_PutString(buffer);
+    REACTION__printNumber(summary.mean);
+    UART_Logs_PutString(" +/- ");
+    REACTION__printNumber(summary.stddev);
+
+    /* Display the distribution of the reaction times in ms on UART. */
+    UART_Logs_PutString("\nmin/p50/p90/max : ");
+    REACTION__printNumber(summary.min);
+    UART_Logs_PutString("/");
+    REACTION__printNumber(summary.p50);
+    UART_Logs_PutString("/");
+    REACTION__printNumber(summary.p90);
+    UART_Logs_PutString("/");
+    REACTION__printNumber(summary.max);
+    UART_Logs_PutString("\n");
 
     return RC_SUCCESS;
 }
@@ -230,22 +242,21 @@ RC_t REACTION_setDisplay(uint16_t randomNumberDisplay) {
 /**
  * @brief Retrieves the reaction time in milliseconds.
  *
- * This function stops the counter, calculates the reaction time based on the counter value,
- * and returns the result through the provided pointer.
+ * This function returns the time from the start of the round to the button press
+ * through the provided pointer, limited to the round duration.
  *
  * @param reactionTime Pointer to the variable where the reaction time will be stored.
+ * @param game Pointer to the game data.
+ * @param pressTimestamp Milliseconds from the start of the round to the button press.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_getReactionTimeMS(uint16_t *reactionTime, Game_t game) {
-    /* Stop the counter. */
-    Counter_Stop();
-
-    /** Calculate the reaction time based on the counter value.
-     *  (Difference between clock frequency and current value)/ period * 1000 = reaction time in ms
+RC_t REACTION_getReactionTimeMS(uint16_t *reactionTime, const Game_t *game, uint16_t pressTimestamp) {
+    /** The press was timestamped by the capture, independent of the counter reload value.
+     *  A press which raced with the timeout counts as the full round.
      */
-    
-    *reactionTime = (countInOneSec*game.durationOfRoundSec - Counter_ReadCounter()) * 1000 / 
-        countInOneSec*game.durationOfRoundSec;
+    uint16_t roundMS = (uint16_t)(game->durationOfRoundSec * 1000U);
+
+    *reactionTime = (pressTimestamp < roundMS) ? pressTimestamp : roundMS;
 
     return RC_SUCCESS;
 }
@@ -266,9 +277,7 @@ RC_t REACTION_displaySuccessMessage(uint16_t reactionTime) {
     UART_Logs_PutString("Reaction Time in ms: ");
 
     /* Convert reaction time to string and display it on UART. */
-    char_t myBuffer[3];
-    REACTION_convertToString(reactionTime, myBuffer);
-    UART_Logs_PutString(myBuffer);
+    REACTION__printNumber(reactionTime);
 
     /* Display a message prompting to continue. */
     UART_Logs_PutString("\nPress any button to continue\n\n");
@@ -312,67 +321,6 @@ RC_t REACTION_displayTimeoutMessage() {
     return RC_SUCCESS;
 }
 
-/**
- * @brief Converts a number to a string.
- *
- * This function converts the given number to a string and stores it in the provided buffer.
- *
- * @param number The number to be converted to a string.
- * @param buffer Pointer to the buffer where the string representation will be stored.
- * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
- */
-RC_t REACTION_convertToString(uint16_t number, char_t *buffer) {
-    if (number == 0){
-        buffer[0] = '0';
-        buffer[1] = '\0';
-        return RC_SUCCESS;
-    }
-    
-    int i = 0;
-
-    /* Convert the number to a string in reverse order. */
-    while (number != 0) {
-        int digit = number % 10;
-        buffer[i++] = digit + '0';
-        number = number / 10;
-    }
-
-    /* Add null terminator to the end of the string. */
-    buffer[i] = '\0';
-
-    /* Reverse the string to get the correct order. */
-    REACTION_reverseString(buffer, i);
-
-    return RC_SUCCESS;
-}
-
-/**
- * @brief Reverses a string in-place.
- *
- * This function reverses the order of characters in the given string in-place.
- *
- * @param str Pointer to the string to be reversed.
- * @param length The length of the string.
- * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
- */
-RC_t REACTION_reverseString(char_t *str, uint8_t length) {
-    int start = 0;
-    int end = length - 1;
-
-    /* Swap characters from start to end to reverse the string. */
-    while (start < end) {
-        char_t temp = str[start];
-        str[start] = str[end];
-        str[end] = temp;
-
-        start++;
-        end--;
-    }
-
-    return RC_SUCCESS;
-}
-
-
 /**
  * @brief Prints the start of a new round on UART.
  *
@@ -387,9 +335,7 @@ RC_t REACTION_printRoundNumber(uint8_t roundNumber) {
     UART_Logs_PutString("\nRound ");
 
     /* Convert the round number to a string and display it on UART. */
-    char_t myBuffer[2];
-    REACTION_convertToString(roundNumber, myBuffer);
-    UART_Logs_PutString(myBuffer);
+    REACTION__printNumber(roundNumber);
 
     /* Display a message indicating that the round has started. */
     UART_Logs_PutString(" started!\n");
@@ -398,15 +344,15 @@ RC_t REACTION_printRoundNumber(uint8_t roundNumber) {
 }
 
 /**
- * @brief Stops the counter.
+ * @brief Stops the round timer.
  *
- * This function stops the counter used for measuring time.
+ * This function cancels the timeout of the running round.
  *
+ * @param game Pointer to the game data.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_stopCounter() {
-    Counter_Stop();
-    return RC_SUCCESS;
+RC_t REACTION_stopRoundTimer(Game_t *game) {
+    return SWTIMER_Cancel(&game->roundTimer);
 }
 
 /**
@@ -425,22 +371,37 @@ RC_t REACTION_resetDisplay() {
  * @brief Checks if the correct button is pressed based on the SEVEN segment display value.
  *
  * This function retrieves the current value from the SEVEN segment display and checks
- * if the corresponding correct button is pressed.
+ * if the corresponding correct button was pressed.
  *
+ * @param buttons Button state sampled at the press, see CAPTURE_BUTTON_MASK().
  * @return Returns TRUE if the correct button is pressed, FALSE otherwise.
  */
-boolean_t REACTION_correctButtonPressed() {
+boolean_t REACTION_correctButtonPressed(uint8_t buttons) {
     /* Retrieve the current value from the SEVEN segment display. */
     sint8_t currentDisplayVal = 0;
     SEVEN_Get(SEVEN_0, &currentDisplayVal);
 
     /* Check if the correct button is pressed based on the SEVEN segment display value. */
-    if (currentDisplayVal == 1 && (BUTTON_IsPressed(Button_Right_1) || BUTTON_IsPressed(Button_Right_2))) {
+    if (currentDisplayVal == 1 &&
+        (buttons & (CAPTURE_BUTTON_MASK(Button_Right_1) | CAPTURE_BUTTON_MASK(Button_Right_2))) != 0) {
         return TRUE;
-    } else if (currentDisplayVal == 2 && (BUTTON_IsPressed(Button_Left_1) || BUTTON_IsPressed(Button_Left_2))) {
+    } else if (currentDisplayVal == 2 &&
+        (buttons & (CAPTURE_BUTTON_MASK(Button_Left_1) | CAPTURE_BUTTON_MASK(Button_Left_2))) != 0) {
         return TRUE;
     } else {
         return FALSE;
     }
 }
 
+/**
+ * @brief Prints a number in decimal on UART.
+ *
+ * @param number The number to be printed, full range.
+ */
+static void REACTION__printNumber(uint32_t number) {
+    char_t buffer[FMT_U32_SIZE];
+
+    if (FMT_U32(number, buffer, sizeof(buffer), NULL) == RC_SUCCESS) {
+        UART_Logs_PutString(buffer);
+    }
+}
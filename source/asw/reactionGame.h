@@ -57,12 +57,19 @@
 #define REACTION_GAME_H
 
 #include "global.h"
+#include "capture.h"
+#include "stats.h"
+#include "swtimer.h"
+#include "reactionGame_cfg.h"
     
 /*****************************************************************************/
 /* Global pre-processor symbols/macros and type declarations                 */
 /*****************************************************************************/
 
 
+/**
+ * @brief States of the game, rows of the transition table in main.c.
+ */
 typedef enum {
     IsWaitingRoundStart,    /**< Waiting for the start of a new round.    */
     IsWaitingDisplay,       /**< Waiting for the display to show a digit. */
@@ -74,14 +81,23 @@ typedef enum {
  * @brief Structure representing the state and statistics of the game.
  */
 typedef struct Game_t{
-    GameStates gameState;          /**< Current state of the game. */
     uint8_t  roundNumber;          /**< Current round number. */
-    uint16_t totalTime;            /**< Total time accumulated across all rounds. */
-    uint8_t correctPresses;        /**< Number of correct user presses. */
+    STATS_t reactionTimes;         /**< Reaction times of the correct presses in ms. */
     uint8_t  maxRounds;            /**< Maximum number of rounds for the game. */
     uint8_t durationOfRoundSec;    /**< Duration of each round in seconds. */
+    SWTIMER_t roundTimer;          /**< Timeout of the running round. */
 } Game_t;
 
+/**
+ * @brief Button press handed from systick_handler to tsk_reactionGame.
+ *
+ * Record of the press message queue, filled in place by the ISR.
+ */
+typedef struct {
+    CAPTURE_event_t capture;       /**< Time since the round start and buttons at the press. */
+    boolean_t correct;             /**< The button matched the display at the press. */
+} REACTION_press_t;
+
 // Wrapper to allow representing the file in Together as class
 #ifdef TOGETHER
 
@@ -104,7 +120,7 @@ public:
  *
  * This function initializes the Reaction Game module by performing the following steps:
  * - Initializing UART communication.
- * - Starting the clock counter for the Reaction Game.
+ * - Setting up the round timer.
  * - Seeding the random number generator.
  * - Setting initial values for the game state, maximum rounds, and round duration.
  * - Displaying a welcome message on the UART.
@@ -112,9 +128,10 @@ public:
  * - Setting the initial round number to 1.
  *
  * @param game Pointer to the Game_t structure.
+ * @param timeout Called from isr_timer when a round ends without reaction.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_init(Game_t* game);
+RC_t REACTION_init(Game_t* game, SWTIMER_callback_t timeout);
 /**
  * @brief Prints the start of a new round on UART.
  *
@@ -128,8 +145,9 @@ RC_t REACTION_printRoundNumber(uint8_t roundNumber);
 /**
  * @brief Displays details of the game on UART.
  *
- * This function displays details such as correct presses, total time, and average time
- * of the game on the UART output.
+ * This function displays the number of correct presses and, if there was one,
+ * mean, standard deviation, min, median, 90th percentile and max of the
+ * reaction times of the game on the UART output.
  *
  * @param game Pointer to the Game_t structure containing game details.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
@@ -185,13 +203,14 @@ RC_t REACTION_displayTimeoutMessage();
  */
 RC_t REACTION_setDisplay(uint16_t randomNumberDisplay);
 /**
- * @brief Stops the counter.
+ * @brief Stops the round timer.
  *
- * This function stops the counter used for measuring time.
+ * This function cancels the timeout of the running round.
  *
+ * @param game Pointer to the game data.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_stopCounter();
+RC_t REACTION_stopRoundTimer(Game_t* game);
 /**
  * @brief Resets the SEVEN segment display.
  *
@@ -203,65 +222,47 @@ RC_t REACTION_resetDisplay();
 /**
  * @brief Generates a random number within a specified limit.
  *
- * This function generates a random number within the specified limit and
- * returns it through the provided pointer.
+ * This function generates a uniformly distributed random number within the
+ * specified limit and returns it through the provided pointer.
  *
- * @param randomNumber Pointer to the variable where the random number will be stored.
- * @param limit The upper limit for the random number (exclusive).
+ * @param randomNumber Pointer to the variable where the random number will be stored, range 1...limit.
+ * @param limit The upper limit for the random number (inclusive), valid range 1...255.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
 RC_t REACTION_generateRandomNum (uint16_t* randomNumber,  uint8_t limit);
 
 /**
- * @brief Starts a counter for a specified duration.
+ * @brief Starts the round timer for the duration of a round.
  *
- * This function starts a counter for a duration specified by the provided random number,
- * which is multiplied by the global RGClockFrequency. The counter is configured to
- * stop after reaching the specified count.
+ * This function starts the one shot round timeout and takes the start of the round
+ * against which the button presses are timestamped.
  *
- * @param randomNumber The random number used to calculate the counter duration.
+ * @param game Pointer to the game data.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_startCounterForTime(uint16_t randomNumber);
+RC_t REACTION_startRoundTimer(Game_t* game);
 /**
  * @brief Retrieves the reaction time in milliseconds.
  *
- * This function stops the counter, calculates the reaction time based on the counter value,
- * and returns the result through the provided pointer.
+ * This function returns the time from the start of the round to the button press
+ * through the provided pointer, limited to the round duration.
  *
  * @param reactionTime Pointer to the variable where the reaction time will be stored.
+ * @param game Pointer to the game data.
+ * @param pressTimestamp Milliseconds from the start of the round to the button press.
  * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
  */
-RC_t REACTION_getReactionTimeMS(uint16_t* reactionTime, Game_t game);
-/**
- * @brief Converts a number to a string.
- *
- * This function converts the given number to a string and stores it in the provided buffer.
- *
- * @param number The number to be converted to a string.
- * @param buffer Pointer to the buffer where the string representation will be stored.
- * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
- */
-RC_t REACTION_convertToString(uint16_t number, char_t* buffer);
-/**
- * @brief Reverses a string in-place.
- *
- * This function reverses the order of characters in the given string in-place.
- *
- * @param str Pointer to the string to be reversed.
- * @param length The length of the string.
- * @return Returns an RC_t (Return Code) indicating the success or failure of the operation.
- */
-RC_t REACTION_reverseString(char_t* str, uint8_t length);
+RC_t REACTION_getReactionTimeMS(uint16_t* reactionTime, const Game_t* game, uint16_t pressTimestamp);
 /**
  * @brief Checks if the correct button is pressed based on the SEVEN segment display value.
  *
  * This function retrieves the current value from the SEVEN segment display and checks
- * if the corresponding correct button is pressed.
+ * if the corresponding correct button was pressed.
  *
+ * @param buttons Button state sampled at the press, see CAPTURE_BUTTON_MASK().
  * @return Returns TRUE if the correct button is pressed, FALSE otherwise.
  */
-boolean_t REACTION_correctButtonPressed();
+boolean_t REACTION_correctButtonPressed(uint8_t buttons);
 
 
 /*****************************************************************************/
@@ -0,0 +1,341 @@
+/**
+* \file replay.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Record and replay of the external inputs of the reaction game
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "replay.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief What the module does with the inputs.
+ */
+typedef enum {
+    REPLAY__IDLE,       /**< Nothing */
+    REPLAY__RECORDING,  /**< Inputs are appended to REPLAY__recording */
+    REPLAY__PLAYING     /**< Inputs are taken from REPLAY__session */
+} REPLAY__state_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static volatile REPLAY__state_t REPLAY__state = REPLAY__IDLE;
+
+/** Ticks since REPLAY_Record() / REPLAY_Play(), written by the system tick ISR only */
+static volatile uint32_t REPLAY__tick = 0;
+
+/** Appended by the task and both ISR2s, a record is complete before the count covers it */
+static REPLAY_record_t REPLAY__recording[REPLAY_RECORDS];
+static volatile uint16_t REPLAY__records = 0;
+static volatile uint16_t REPLAY__dropped = 0;
+
+static const REPLAY_record_t* REPLAY__session = NULL;
+static uint16_t REPLAY__sessionRecords = 0;
+/** Next record to look at for REPLAY_Value(), task only */
+static uint16_t REPLAY__valueCursor = 0;
+/** Next record to look at for REPLAY_GetStimulus(), system tick ISR only */
+static uint16_t REPLAY__stimulusCursor = 0;
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static RC_t REPLAY__append(const REPLAY_record_t* record);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Clears the recording and starts recording at tick 0.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPLAY_Record(void)
+{
+    SuspendOSInterrupts();
+    REPLAY__records = 0;
+    REPLAY__dropped = 0;
+    REPLAY__tick = 0;
+    REPLAY__state = REPLAY__RECORDING;
+    ResumeOSInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Starts replaying a session at tick 0.
+ *
+ * @param session Records as printed while recording, must stay valid.
+ * @param records Number of records, valid range 1...65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t REPLAY_Play(const REPLAY_record_t* session, uint16_t records)
+{
+    if (session == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (records == 0)
+    {
+        return RC_ERROR_ZERO;
+    }
+    
+    SuspendOSInterrupts();
+    REPLAY__session = session;
+    REPLAY__sessionRecords = records;
+    REPLAY__valueCursor = 0;
+    REPLAY__stimulusCursor = 0;
+    REPLAY__tick = 0;
+    REPLAY__state = REPLAY__PLAYING;
+    ResumeOSInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Advances the replay tick, to be called once per system tick from its ISR.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPLAY_Tick(void)
+{
+    ++REPLAY__tick;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Tells whether live inputs have to be dropped.
+ *
+ * @return TRUE while a session is replayed.
+ */
+boolean_t REPLAY_IsPlaying(void)
+{
+    return (REPLAY__state == REPLAY__PLAYING) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Passes a REPLAY_SEED or REPLAY_ENTROPY value through the replay.
+ *
+ * @param kind REPLAY_SEED or REPLAY_ENTROPY.
+ * @param value Live value, receives the recorded one while replaying.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_FULL if the recording is full,
+ *         RC_ERROR_BAD_DATA if the session holds no further value of this kind.
+ */
+RC_t REPLAY_Value(REPLAY_kind_t kind, uint32_t* value)
+{
+    if (value == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if ((kind != REPLAY_SEED) && (kind != REPLAY_ENTROPY))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    if (REPLAY__state == REPLAY__RECORDING)
+    {
+        REPLAY_record_t record = {*value, 0, 0, (uint8_t)kind};
+        
+        return REPLAY__append(&record);
+    }
+    
+    if (REPLAY__state == REPLAY__PLAYING)
+    {
+        /* Values are consumed in session order, stimuli in between are skipped */
+        while (REPLAY__valueCursor < REPLAY__sessionRecords)
+        {
+            const REPLAY_record_t* record = &REPLAY__session[REPLAY__valueCursor++];
+            
+            if (record->kind == (uint8_t)kind)
+            {
+                *value = record->value;
+                return RC_SUCCESS;
+            }
+            if ((record->kind == REPLAY_SEED) || (record->kind == REPLAY_ENTROPY))
+            {
+                /* The game asked for something else than it did when recording */
+                return RC_ERROR_BAD_DATA;
+            }
+        }
+        return RC_ERROR_BAD_DATA;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Records a REPLAY_BUTTON or REPLAY_TIMEOUT at the current tick.
+ *
+ * @param kind REPLAY_BUTTON or REPLAY_TIMEOUT.
+ * @param event The capture of REPLAY_BUTTON, ignored (may be NULL) for REPLAY_TIMEOUT.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_INVALID_STATE if not recording, RC_ERROR_BUFFER_FULL.
+ */
+RC_t REPLAY_Stimulus(REPLAY_kind_t kind, const CAPTURE_event_t* event)
+{
+    if ((kind != REPLAY_BUTTON) && (kind != REPLAY_TIMEOUT))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    if ((kind == REPLAY_BUTTON) && (event == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (REPLAY__state != REPLAY__RECORDING)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    REPLAY_record_t record = {REPLAY__tick, 0, 0, (uint8_t)kind};
+    
+    if (kind == REPLAY_BUTTON)
+    {
+        record.timestamp = event->timestamp;
+        record.buttons = event->buttons;
+    }
+
+    return REPLAY__append(&record);
+}
+
+/**
+ * @brief Returns the next REPLAY_BUTTON or REPLAY_TIMEOUT of the session which is due.
+ *
+ * @param kind Pointer receiving REPLAY_BUTTON or REPLAY_TIMEOUT.
+ * @param event Pointer receiving the capture of a REPLAY_BUTTON.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_INVALID_STATE if not replaying,
+ *         RC_ERROR_BUFFER_EMTPY if nothing is due.
+ */
+RC_t REPLAY_GetStimulus(REPLAY_kind_t* kind, CAPTURE_event_t* event)
+{
+    if ((kind == NULL) || (event == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (REPLAY__state != REPLAY__PLAYING)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    /* Values are taken by REPLAY_Value() */
+    while ((REPLAY__stimulusCursor < REPLAY__sessionRecords) &&
+           (REPLAY__session[REPLAY__stimulusCursor].kind != REPLAY_BUTTON) &&
+           (REPLAY__session[REPLAY__stimulusCursor].kind != REPLAY_TIMEOUT))
+    {
+        ++REPLAY__stimulusCursor;
+    }
+    
+    if ((REPLAY__stimulusCursor == REPLAY__sessionRecords) ||
+        (REPLAY__session[REPLAY__stimulusCursor].value > REPLAY__tick))
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+    
+    const REPLAY_record_t* record = &REPLAY__session[REPLAY__stimulusCursor++];
+    
+    *kind = (REPLAY_kind_t)record->kind;
+    event->timestamp = record->timestamp;
+    event->buttons = record->buttons;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the number of records of the recording.
+ *
+ * @param records Pointer receiving the number of records.
+ * @param dropped Pointer receiving the number of inputs lost because the recording was full.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t REPLAY_GetCount(uint16_t* records, uint16_t* dropped)
+{
+    if ((records == NULL) || (dropped == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    *records = REPLAY__records;
+    *dropped = REPLAY__dropped;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns one record of the recording.
+ *
+ * @param index Index, valid range 0...records-1 of REPLAY_GetCount().
+ * @param record Pointer receiving the record.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_RANGE.
+ */
+RC_t REPLAY_GetRecord(uint16_t index, REPLAY_record_t* record)
+{
+    if (record == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (index >= REPLAY__records)
+    {
+        return RC_ERROR_RANGE;
+    }
+    
+    /* Records below the count are not written any more */
+    *record = REPLAY__recording[index];
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Appends a record to the recording.
+ *
+ * @param record Record to append.
+ * @return RC_SUCCESS or RC_ERROR_BUFFER_FULL.
+ */
+static RC_t REPLAY__append(const REPLAY_record_t* record)
+{
+    RC_t rc = RC_SUCCESS;
+    
+    /* Task and ISR2s append */
+    SuspendOSInterrupts();
+    if (REPLAY__records < REPLAY_RECORDS)
+    {
+        REPLAY__recording[REPLAY__records] = *record;
+        ++REPLAY__records;
+    }
+    else
+    {
+        ++REPLAY__dropped;
+        rc = RC_ERROR_BUFFER_FULL;
+    }
+    ResumeOSInterrupts();
+
+    return rc;
+}
@@ -0,0 +1,225 @@
+/**
+* \file replay.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Record and replay of the external inputs of the reaction game
+*
+* Everything the game cannot predict is logged as a stream of 8 byte
+* records: the random seed, the entropy samples, the button presses as
+* handed over by the capture buffer and the round timeouts, the latter two
+* with the system tick they were processed in. The alarms follow from
+* these inputs and are not recorded.
+* A recorded stream is printed as C initialiser rows. Compiled back in as a
+* session, it is fed through the same entry points (systick_handler press
+* handling, the timeout event of isr_timer, the PRNG seeding) while the live
+* inputs are dropped. The game then takes exactly the recorded path, and its
+* timing can be compared between builds with the runtime and budget reports.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "global.h"
+#include "capture.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define REPLAY_OFF          0       /**< REPLAY_MODE: live inputs only */
+#define REPLAY_RECORD       1       /**< REPLAY_MODE: live inputs are recorded */
+#define REPLAY_PLAY         2       /**< REPLAY_MODE: replay_session.inc replaces the live inputs */
+
+#define REPLAY_MODE         REPLAY_OFF  /**< Started by tsk_auto */
+
+#define REPLAY_RECORDS      256     /**< Capacity of the recording, 8 byte each */
+
+//####################### ENUMERATIONS
+
+/**
+ * @brief Kind of a record.
+ */
+typedef enum {
+    REPLAY_SEED,        /**< PRNG seed, value */
+    REPLAY_ENTROPY,     /**< PRNG entropy sample, value */
+    REPLAY_BUTTON,      /**< Button press at a tick, timestamp and buttons of the capture */
+    REPLAY_TIMEOUT      /**< Round timeout at a tick */
+} REPLAY_kind_t;
+
+//####################### STRUCTURES
+
+/**
+ * @brief One recorded input.
+ */
+typedef struct {
+    uint32_t value;         /**< Tick of REPLAY_BUTTON / REPLAY_TIMEOUT, the value otherwise */
+    uint16_t timestamp;     /**< REPLAY_BUTTON: CAPTURE_event_t::timestamp */
+    uint8_t  buttons;       /**< REPLAY_BUTTON: CAPTURE_event_t::buttons */
+    uint8_t  kind;          /**< REPLAY_kind_t */
+} REPLAY_record_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class REPLAY
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Clears the recording and starts recording at tick 0.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPLAY_Record(void);
+
+/**
+ * @brief Starts replaying a session at tick 0.
+ *
+ * @param session Records as printed while recording, must stay valid.
+ * @param records Number of records, valid range 1...65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t REPLAY_Play(const REPLAY_record_t* session, uint16_t records);
+
+/**
+ * @brief Advances the replay tick, to be called once per system tick from its ISR.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPLAY_Tick(void);
+
+/**
+ * @brief Tells whether live inputs have to be dropped.
+ *
+ * @return TRUE while a session is replayed.
+ */
+boolean_t REPLAY_IsPlaying(void);
+
+/**
+ * @brief Passes a REPLAY_SEED or REPLAY_ENTROPY value through the replay.
+ *
+ * Records the value, or replaces it by the next recorded one of the session.
+ * Without recording or replay the value is left alone.
+ *
+ * @param kind REPLAY_SEED or REPLAY_ENTROPY.
+ * @param value Live value, receives the recorded one while replaying.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_FULL if the recording is full,
+ *         RC_ERROR_BAD_DATA if the session holds no further value of this kind.
+ */
+RC_t REPLAY_Value(REPLAY_kind_t kind, uint32_t* value);
+
+/**
+ * @brief Records a REPLAY_BUTTON or REPLAY_TIMEOUT at the current tick.
+ *
+ * @param kind REPLAY_BUTTON or REPLAY_TIMEOUT.
+ * @param event The capture of REPLAY_BUTTON, ignored (may be NULL) for REPLAY_TIMEOUT.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_INVALID_STATE if not recording, RC_ERROR_BUFFER_FULL.
+ */
+RC_t REPLAY_Stimulus(REPLAY_kind_t kind, const CAPTURE_event_t* event);
+
+/**
+ * @brief Returns the next REPLAY_BUTTON or REPLAY_TIMEOUT of the session which is due.
+ *
+ * Only one context may consume, in the order of the session.
+ *
+ * @param kind Pointer receiving REPLAY_BUTTON or REPLAY_TIMEOUT.
+ * @param event Pointer receiving the capture of a REPLAY_BUTTON.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_INVALID_STATE if not replaying,
+ *         RC_ERROR_BUFFER_EMTPY if nothing is due.
+ */
+RC_t REPLAY_GetStimulus(REPLAY_kind_t* kind, CAPTURE_event_t* event);
+
+/**
+ * @brief Returns the number of records of the recording.
+ *
+ * @param records Pointer receiving the number of records.
+ * @param dropped Pointer receiving the number of inputs lost because the recording was full.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t REPLAY_GetCount(uint16_t* records, uint16_t* dropped);
+
+/**
+ * @brief Returns one record of the recording.
+ *
+ * @param index Index, valid range 0...records-1 of REPLAY_GetCount().
+ * @param record Pointer receiving the record.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_RANGE.
+ */
+RC_t REPLAY_GetRecord(uint16_t index, REPLAY_record_t* record);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* REPLAY_H */
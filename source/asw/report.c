@@ -0,0 +1,340 @@
+/**
+* \file report.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief UART reports of the measurements, printed by tsk_background
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "report.h"
+#include "runtime.h"
+#include "latency.h"
+#include "governor.h"
+#include "timebase.h"
+#include "fmt.h"
+#include <stdlib.h>
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define REPORT__DIGITS              11      /**< Any uint32_t in any base from 10 up, with terminator */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/** Names of the accounted ISR2s, in the order of RUNTIME_isr_t */
+static const char_t* const REPORT__isrNames[RUNTIME_ISRS] = {"systick_handler", "isr_timer"};
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+#if (LATENCY_BENCHMARK == ON)
+/**
+ * @brief Prints p50/p99/max entry latency and NVIC priority of every probe.
+ *
+ * Values are CPU cycles. The priorities are read back from the NVIC and the
+ * kernel masking, PendSV and code placement modes are printed, so reports of
+ * different configurations can be told apart. Needs LATENCY_BENCHMARK.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Latency(void)
+{
+    static const char_t* const names[LATENCY_PROBES] = {"systick", "buttons", "timer", "dispatch", "return", "signal"};
+    const uint8_t priorities[LATENCY_DISPATCH] = {
+        EE_CORTEX_MX_SYSTICK_ISR_PRI >> 5,
+        CyIntGetPriority(isr_buttons__INTC_NUMBER),
+        CyIntGetPriority(isr_timer__INTC_NUMBER)
+    };
+    char_t buffer[REPORT__DIGITS];
+    LATENCY_stats_t stats;
+
+    UART_Logs_PutString("\nISR latency [cycles]\n");
+#ifdef EE_CORTEX_MX_KERNEL_BASEPRI
+    UART_Logs_PutString("kernel masking BASEPRI prio ");
+    UART_Logs_PutString(utoa(HAL_PRIO_KERNEL, buffer, 10));
+    UART_Logs_PutString("\n");
+#else
+    UART_Logs_PutString("kernel masking PRIMASK\n");
+#endif
+#ifdef EE_CORTEX_MX_LAZY_PENDSV
+    UART_Logs_PutString("PendSV only on preemption\n");
+#else
+    UART_Logs_PutString("PendSV after every ISR2\n");
+#endif
+#if (LATENCY_SIGNAL_FROM_ISR == ON)
+    UART_Logs_PutString("signal by SetEventFromISR\n");
+#else
+    UART_Logs_PutString("signal by SetEvent\n");
+#endif
+
+    // The region of .ramfunc is chosen by the linker script
+    if ((uint32_t)&systick_handler >= CYDEV_SRAM_BASE)
+    {
+        UART_Logs_PutString("kernel and ISR paths in SRAM\n");
+    }
+    else
+    {
+        UART_Logs_PutString("kernel and ISR paths in flash\n");
+    }
+
+    for (uint8_t i = 0; i < LATENCY_PROBES; ++i)
+    {
+        if (LATENCY_GetStats((LATENCY_probe_t)i, &stats) != RC_SUCCESS)
+        {
+            continue;
+        }
+        UART_Logs_PutString(names[i]);
+        if (i < LATENCY_DISPATCH)
+        {
+            UART_Logs_PutString(" prio ");
+            UART_Logs_PutString(utoa(priorities[i], buffer, 10));
+        }
+        UART_Logs_PutString(" n ");
+        UART_Logs_PutString(utoa(stats.samples, buffer, 10));
+        UART_Logs_PutString(" p50 ");
+        UART_Logs_PutString(utoa(stats.p50, buffer, 10));
+        UART_Logs_PutString(" p99 ");
+        UART_Logs_PutString(utoa(stats.p99, buffer, 10));
+        UART_Logs_PutString(" max ");
+        UART_Logs_PutString(utoa(stats.max, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+
+    return RC_SUCCESS;
+}
+#endif
+
+/**
+ * @brief Prints the uptime, the CPU clock and the load of the periodic tasks, the ISR2s and idle.
+ *
+ * Values are 1/1000 of the sliding window, tsk_background is reported as idle.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Runtime(void)
+{
+    static const TaskType tasks[] = {tsk_fader, tsk_glower, tsk_reactionGame};
+    char_t buffer[FMT_U32_SIZE];
+    uint32_t clock = 0;
+    uint16_t load = 0;
+
+    // Uptime in s, the time base does not wrap
+    FMT_U32((uint32_t)(TIMEBASE_TO_MS(TIMEBASE_Now()) / 1000U), buffer, sizeof(buffer), NULL);
+    UART_Logs_PutString("\nCPU load [1/1000] at ");
+    UART_Logs_PutString(buffer);
+    UART_Logs_PutString(" s\n");
+
+    // Full speed unless the governor runs
+    if (GOVERNOR_GetClock(&clock) == RC_SUCCESS)
+    {
+        FMT_U32(clock / 1000U, buffer, sizeof(buffer), NULL);
+        UART_Logs_PutString("clock ");
+        UART_Logs_PutString(buffer);
+        UART_Logs_PutString(" kHz\n");
+    }
+
+    for (uint8_t i = 0; i < sizeof(tasks) / sizeof(tasks[0]); ++i)
+    {
+        if (RUNTIME_GetTaskLoad(tasks[i], &load) == RC_SUCCESS)
+        {
+            UART_Logs_PutString(EE_TASK_NAME[tasks[i]]);
+            UART_Logs_PutString(" ");
+            UART_Logs_PutString(utoa(load, buffer, 10));
+            UART_Logs_PutString("\n");
+        }
+    }
+    for (uint8_t i = 0; i < RUNTIME_ISRS; ++i)
+    {
+        if (RUNTIME_GetIsrLoad((RUNTIME_isr_t)i, &load) == RC_SUCCESS)
+        {
+            UART_Logs_PutString(REPORT__isrNames[i]);
+            UART_Logs_PutString(" ");
+            UART_Logs_PutString(utoa(load, buffer, 10));
+            UART_Logs_PutString("\n");
+        }
+    }
+    if (RUNTIME_GetTaskLoad(tsk_background, &load) == RC_SUCCESS)
+    {
+        UART_Logs_PutString("idle ");
+        UART_Logs_PutString(utoa(load, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Prints the transition coverage of a state machine.
+ *
+ * @param fsm State machine initialised with coverage counters.
+ * @param states Name of every state, fsm->states entries.
+ * @param events Name of every event, fsm->events entries.
+ * @return RC_SUCCESS, RC_ERROR_NULL or the error of FSM_GetCoverage().
+ */
+RC_t REPORT_Transitions(const FSM_t* fsm, const char_t* const states[], const char_t* const events[])
+{
+    char_t buffer[REPORT__DIGITS];
+    uint16_t count = 0;
+    uint16_t defined = 0;
+    uint16_t hit = 0;
+    uint32_t ignored = 0;
+
+    if ((fsm == NULL) || (states == NULL) || (events == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    UART_Logs_PutString("\nTransitions\n");
+    for (uint8_t state = 0; state < fsm->states; ++state)
+    {
+        for (uint8_t event = 0; event < fsm->events; ++event)
+        {
+            // Cells which ignore their event are summed up below
+            if ((fsm->table[(uint16_t)state * fsm->events + event] != FSM_IGNORE) &&
+                (FSM_GetTransitionCount(fsm, state, event, &count) == RC_SUCCESS))
+            {
+                UART_Logs_PutString(states[state]);
+                UART_Logs_PutString(" ");
+                UART_Logs_PutString(events[event]);
+                UART_Logs_PutString(" ");
+                UART_Logs_PutString(utoa(count, buffer, 10));
+                UART_Logs_PutString("\n");
+            }
+        }
+    }
+
+    RC_t result = FSM_GetCoverage(fsm, &defined, &hit, &ignored);
+    if (result != RC_SUCCESS)
+    {
+        return result;
+    }
+    UART_Logs_PutString("covered ");
+    UART_Logs_PutString(utoa(hit, buffer, 10));
+    UART_Logs_PutString("/");
+    UART_Logs_PutString(utoa(defined, buffer, 10));
+    UART_Logs_PutString(" ignored ");
+    UART_Logs_PutString(utoa(ignored, buffer, 10));
+    UART_Logs_PutString("\n");
+
+    return RC_SUCCESS;
+}
+
+#ifdef EE_EXECUTION_BUDGET__
+/**
+ * @brief Prints the execution budget statistics of the tasks and ISR2s.
+ *
+ * Longest job and budget overruns are counted by the kernel (tasks, see
+ * budget_cfg.h) and by the runtime module (ISR2s), times are in us. The
+ * cycles are converted with the current clock of the governor. Needs
+ * EE_EXECUTION_BUDGET__.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Budgets(void)
+{
+    uint32_t clock = EE_CPU_CLOCK;
+    char_t buffer[REPORT__DIGITS];
+    EE_as_eb_RAM_type task;
+    RUNTIME_isrBudget_t isr;
+
+    GOVERNOR_GetClock(&clock);
+    const uint32_t cyclesPerUs = clock / 1000000U;
+
+    UART_Logs_PutString("\nBudgets [us]\n");
+    for (TaskType i = 0; i < EE_MAX_TASK; ++i)
+    {
+        if (GetExecutionBudgetStats(i, &task) != E_OK)
+        {
+            continue;
+        }
+        UART_Logs_PutString(EE_TASK_NAME[i]);
+        UART_Logs_PutString(" jobs ");
+        UART_Logs_PutString(utoa(task.jobs, buffer, 10));
+        UART_Logs_PutString(" max ");
+        UART_Logs_PutString(utoa(task.max_cycles / cyclesPerUs, buffer, 10));
+        UART_Logs_PutString(" overruns ");
+        UART_Logs_PutString(utoa(task.overruns, buffer, 10));
+        UART_Logs_PutString(" early ");
+        UART_Logs_PutString(utoa(task.arrival_violations, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+    for (uint8_t i = 0; i < RUNTIME_ISRS; ++i)
+    {
+        if (RUNTIME_GetIsrBudget((RUNTIME_isr_t)i, &isr) != RC_SUCCESS)
+        {
+            continue;
+        }
+        UART_Logs_PutString(REPORT__isrNames[i]);
+        UART_Logs_PutString(" max ");
+        UART_Logs_PutString(utoa(isr.maxCycles / cyclesPerUs, buffer, 10));
+        UART_Logs_PutString(" overruns ");
+        UART_Logs_PutString(utoa(isr.overruns, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+
+    return RC_SUCCESS;
+}
+#endif
+
+#ifdef EE_CS_PROFILE__
+/**
+ * @brief Prints the longest interrupt-disable sections and their call sites.
+ *
+ * The site is an address inside the function which masked the interrupts,
+ * resolve it with the map file. Lengths are CPU cycles. Needs EE_CS_PROFILE__.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_CriticalSections(void)
+{
+    static EE_cs_profile_type profile;
+    char_t buffer[REPORT__DIGITS];
+
+    EE_cs_profile_read(&profile);
+
+    UART_Logs_PutString("\nCritical sections [cycles] n ");
+    UART_Logs_PutString(utoa(profile.sections, buffer, 10));
+    UART_Logs_PutString(" dropped ");
+    UART_Logs_PutString(utoa(profile.dropped, buffer, 10));
+    UART_Logs_PutString("\n");
+    for (uint8_t i = 0; i < EE_CS_PROFILE_TOP_N; ++i)
+    {
+        if (profile.top[i].count == 0)
+        {
+            break;
+        }
+        UART_Logs_PutString("0x");
+        UART_Logs_PutString(utoa((uint32_t)profile.top[i].site, buffer, 16));
+        UART_Logs_PutString(" max ");
+        UART_Logs_PutString(utoa(profile.top[i].max_cycles, buffer, 10));
+        UART_Logs_PutString(" n ");
+        UART_Logs_PutString(utoa(profile.top[i].count, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+
+    return RC_SUCCESS;
+}
+#endif
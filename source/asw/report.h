@@ -0,0 +1,155 @@
+/**
+* \file report.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief UART reports of the measurements, printed by tsk_background
+*
+* Every report reads the statistics of one module and prints them as plain
+* text lines on UART_Logs: the ISR entry latencies with LATENCY_BENCHMARK,
+* the CPU load, the state machine coverage, the execution budgets and the
+* critical sections with RUNTIME_REPORT.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef REPORT_H
+#define REPORT_H
+
+#include "global.h"
+#include "fsm.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class REPORT
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Prints p50/p99/max entry latency and NVIC priority of every probe.
+ *
+ * Values are CPU cycles. The priorities are read back from the NVIC and the
+ * kernel masking, PendSV and code placement modes are printed, so reports of
+ * different configurations can be told apart. Needs LATENCY_BENCHMARK.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Latency(void);
+
+/**
+ * @brief Prints the uptime, the CPU clock and the load of the periodic tasks, the ISR2s and idle.
+ *
+ * Values are 1/1000 of the sliding window, tsk_background is reported as idle.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Runtime(void);
+
+/**
+ * @brief Prints the transition coverage of a state machine.
+ *
+ * Every transition of the table is listed with its dispatch count, followed
+ * by the number of transitions taken at least once and the number of events
+ * dropped in states which ignore them.
+ *
+ * @param fsm State machine initialised with coverage counters.
+ * @param states Name of every state, fsm->states entries.
+ * @param events Name of every event, fsm->events entries.
+ * @return RC_SUCCESS, RC_ERROR_NULL or the error of FSM_GetCoverage().
+ */
+RC_t REPORT_Transitions(const FSM_t* fsm, const char_t* const states[], const char_t* const events[]);
+
+/**
+ * @brief Prints the execution budget statistics of the tasks and ISR2s.
+ *
+ * Longest job and budget overruns are counted by the kernel (tasks, see
+ * budget_cfg.h) and by the runtime module (ISR2s), times are in us. The
+ * cycles are converted with the current clock of the governor. Needs
+ * EE_EXECUTION_BUDGET__.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_Budgets(void);
+
+/**
+ * @brief Prints the longest interrupt-disable sections and their call sites.
+ *
+ * The site is an address inside the function which masked the interrupts,
+ * resolve it with the map file. Lengths are CPU cycles. Needs EE_CS_PROFILE__.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t REPORT_CriticalSections(void);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* REPORT_H */
@@ -0,0 +1,446 @@
+/**
+* \file runtime.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Per task and per ISR2 execution time accounting and CPU load
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "runtime.h"
+#include "cycle.h"
+#include <string.h>
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define RUNTIME__MAX_NESTING        4       /**< Maximum ISR2 nesting depth which is accounted */
+#define RUNTIME__PERMILLE           1000u   /**< Full load */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Cycles spent during one sample of the sliding window.
+ */
+typedef struct {
+    uint32_t total;                         /**< Length of the sample */
+    uint32_t task[EE_MAX_TASK];             /**< Cycles per task */
+    uint32_t isr[RUNTIME_ISRS];             /**< Cycles per ISR */
+} RUNTIME__sample_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static volatile uint32_t RUNTIME__taskCycles[EE_MAX_TASK];  /**< Accumulated cycles per task */
+static volatile uint32_t RUNTIME__isrCycles[RUNTIME_ISRS];  /**< Accumulated cycles per ISR */
+
+static volatile TaskType RUNTIME__running = INVALID_TASK;   /**< Task between PreTaskHook and PostTaskHook */
+static volatile uint32_t RUNTIME__taskStart = 0;            /**< Start of the running task's current slice */
+
+static volatile uint8_t  RUNTIME__isrDepth = 0;                         /**< Current ISR2 nesting depth */
+static volatile uint32_t RUNTIME__isrStart[RUNTIME__MAX_NESTING];       /**< Entry time per nesting level */
+static volatile uint32_t RUNTIME__isrNested[RUNTIME__MAX_NESTING];      /**< Cycles of ISRs nested into a level */
+
+static volatile RUNTIME_isrBudget_t RUNTIME__isrBudget[RUNTIME_ISRS];  /**< Budget statistics per ISR */
+
+/**
+ * @brief Budget per ISR in CPU cycles, 0 disables the check.
+ */
+static const uint32_t RUNTIME__isrBudgetCycles[RUNTIME_ISRS] = {
+#ifdef EE_EXECUTION_BUDGET__
+    EE_AS_EB_MICRO_TO_CYCLES(BUDGET_SYSTICK_US),
+    EE_AS_EB_MICRO_TO_CYCLES(BUDGET_TIMER_US)
+#else
+    0, 0
+#endif
+};
+
+static RUNTIME__sample_t RUNTIME__window[RUNTIME_WINDOW_SAMPLES];       /**< Sliding window */
+static RUNTIME__sample_t RUNTIME__snapshot;                 /**< Accumulators at the start of the open sample */
+static uint8_t  RUNTIME__sampleIndex = 0;                   /**< Slot the open sample is stored to */
+static uint8_t  RUNTIME__samplesValid = 0;                  /**< Completed samples, up to RUNTIME_WINDOW_SAMPLES */
+static uint16_t RUNTIME__sampleMs = 0;                      /**< Milliseconds of the open sample */
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/**
+ * @brief Charges the running task's slice up to now.
+ *
+ * @param now Current cycle counter.
+ */
+static void RUNTIME__chargeTask(uint32_t now);
+
+/**
+ * @brief Sums the window length, to be called with interrupts suspended.
+ *
+ * @return Cycles covered by the completed samples.
+ */
+static uint64_t RUNTIME__windowCycles(void);
+
+/**
+ * @brief Converts busy cycles into a load.
+ *
+ * @param busy Busy cycles within the window.
+ * @param total Length of the window in cycles.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS or RC_ERROR_BUFFER_EMTPY if no sample is complete.
+ */
+static RC_t RUNTIME__permille(uint64_t busy, uint64_t total, uint16_t* permille);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and clears all accounts.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t RUNTIME_Init(void)
+{
+    CYCLE_Init();
+
+    SuspendAllInterrupts();
+    for (uint8_t i = 0; i < EE_MAX_TASK; i++)
+    {
+        RUNTIME__taskCycles[i] = 0;
+    }
+    for (uint8_t i = 0; i < RUNTIME_ISRS; i++)
+    {
+        RUNTIME__isrCycles[i] = 0;
+        RUNTIME__isrBudget[i].maxCycles = 0;
+        RUNTIME__isrBudget[i].overruns = 0;
+    }
+    memset(RUNTIME__window, 0, sizeof(RUNTIME__window));
+    memset(&RUNTIME__snapshot, 0, sizeof(RUNTIME__snapshot));
+    RUNTIME__snapshot.total = CYCLE_NOW();
+    RUNTIME__taskStart = RUNTIME__snapshot.total;
+    RUNTIME__sampleIndex = 0;
+    RUNTIME__samplesValid = 0;
+    RUNTIME__sampleMs = 0;
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Kernel hook, called before a task is dispatched or resumed.
+ */
+void PreTaskHook(void)
+{
+    TaskType task = INVALID_TASK;
+
+    GetTaskID(&task);
+    RUNTIME__running = task;
+    RUNTIME__taskStart = CYCLE_NOW();
+}
+
+/**
+ * @brief Kernel hook, called before a task terminates or is preempted.
+ */
+void PostTaskHook(void)
+{
+    RUNTIME__chargeTask(CYCLE_NOW());
+    RUNTIME__running = INVALID_TASK;
+}
+
+/**
+ * @brief Marks the start of an ISR2 body, first statement of the ISR.
+ *
+ * @return RC_SUCCESS, RC_ERROR_OVERRUN if the ISRs nest too deep (not accounted).
+ */
+RC_t RUNTIME_IsrEnter(void)
+{
+    uint32_t now = CYCLE_NOW();
+
+    if (RUNTIME__isrDepth >= RUNTIME__MAX_NESTING)
+    {
+        return RC_ERROR_OVERRUN;
+    }
+
+    // The interrupted task is charged up to here, ISR time is not its own
+    if (0 == RUNTIME__isrDepth)
+    {
+        RUNTIME__chargeTask(now);
+    }
+
+    RUNTIME__isrStart[RUNTIME__isrDepth] = now;
+    RUNTIME__isrNested[RUNTIME__isrDepth] = 0;
+    RUNTIME__isrDepth++;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Marks the end of an ISR2 body, last statement of the ISR.
+ *
+ * The net execution time is checked against the ISR budget of budget_cfg.h.
+ *
+ * @param isr ISR to charge.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_INVALID_STATE without RUNTIME_IsrEnter().
+ */
+RC_t RUNTIME_IsrExit(RUNTIME_isr_t isr)
+{
+    uint32_t now = CYCLE_NOW();
+
+    if (isr >= RUNTIME_ISRS)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    if (0 == RUNTIME__isrDepth)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+
+    RUNTIME__isrDepth--;
+    uint32_t elapsed = now - RUNTIME__isrStart[RUNTIME__isrDepth];
+    uint32_t own = elapsed - RUNTIME__isrNested[RUNTIME__isrDepth];
+    RUNTIME__isrCycles[isr] += own;
+
+    // Budget check on the net time of this body
+    if (own > RUNTIME__isrBudget[isr].maxCycles)
+    {
+        RUNTIME__isrBudget[isr].maxCycles = own;
+    }
+    if ((0 != RUNTIME__isrBudgetCycles[isr]) && (own > RUNTIME__isrBudgetCycles[isr]))
+    {
+        RUNTIME__isrBudget[isr].overruns++;
+    }
+
+    // Nested ISRs are removed from the outer ISR, the outermost restarts the task slice
+    if (0 != RUNTIME__isrDepth)
+    {
+        RUNTIME__isrNested[RUNTIME__isrDepth - 1] += elapsed;
+    }
+    else
+    {
+        RUNTIME__taskStart = now;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Advances the sliding window, to be called every 1 ms from systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t RUNTIME_Tick(void)
+{
+    RUNTIME__sampleMs++;
+    if (RUNTIME__sampleMs < RUNTIME_SAMPLE_MS)
+    {
+        return RC_SUCCESS;
+    }
+    RUNTIME__sampleMs = 0;
+
+    // Close the open sample: difference of the accumulators since its start
+    RUNTIME__sample_t* sample = &RUNTIME__window[RUNTIME__sampleIndex];
+    uint32_t now = CYCLE_NOW();
+
+    sample->total = now - RUNTIME__snapshot.total;
+    RUNTIME__snapshot.total = now;
+    for (uint8_t i = 0; i < EE_MAX_TASK; i++)
+    {
+        uint32_t cycles = RUNTIME__taskCycles[i];
+        sample->task[i] = cycles - RUNTIME__snapshot.task[i];
+        RUNTIME__snapshot.task[i] = cycles;
+    }
+    for (uint8_t i = 0; i < RUNTIME_ISRS; i++)
+    {
+        uint32_t cycles = RUNTIME__isrCycles[i];
+        sample->isr[i] = cycles - RUNTIME__snapshot.isr[i];
+        RUNTIME__snapshot.isr[i] = cycles;
+    }
+
+    RUNTIME__sampleIndex = (RUNTIME__sampleIndex + 1) % RUNTIME_WINDOW_SAMPLES;
+    if (RUNTIME__samplesValid < RUNTIME_WINDOW_SAMPLES)
+    {
+        RUNTIME__samplesValid++;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the CPU load of a task over the sliding window.
+ *
+ * @param task Task identifier.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY before the first sample is complete.
+ */
+RC_t RUNTIME_GetTaskLoad(TaskType task, uint16_t* permille)
+{
+    if (NULL == permille)
+    {
+        return RC_ERROR_NULL;
+    }
+    if (task >= EE_MAX_TASK)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    uint64_t busy = 0;
+
+    // The window is written by the systick, read it as one consistent set
+    SuspendAllInterrupts();
+    for (uint8_t i = 0; i < RUNTIME__samplesValid; i++)
+    {
+        busy += RUNTIME__window[i].task[task];
+    }
+    uint64_t total = RUNTIME__windowCycles();
+    ResumeAllInterrupts();
+
+    return RUNTIME__permille(busy, total, permille);
+}
+
+/**
+ * @brief Returns the CPU load of an ISR2 over the sliding window.
+ *
+ * @param isr ISR identifier.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY before the first sample is complete.
+ */
+RC_t RUNTIME_GetIsrLoad(RUNTIME_isr_t isr, uint16_t* permille)
+{
+    if (NULL == permille)
+    {
+        return RC_ERROR_NULL;
+    }
+    if (isr >= RUNTIME_ISRS)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    uint64_t busy = 0;
+
+    SuspendAllInterrupts();
+    for (uint8_t i = 0; i < RUNTIME__samplesValid; i++)
+    {
+        busy += RUNTIME__window[i].isr[isr];
+    }
+    uint64_t total = RUNTIME__windowCycles();
+    ResumeAllInterrupts();
+
+    return RUNTIME__permille(busy, total, permille);
+}
+
+/**
+ * @brief Returns the execution budget statistics of an ISR2.
+ *
+ * @param isr ISR identifier.
+ * @param stats Pointer receiving the statistics.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM.
+ */
+RC_t RUNTIME_GetIsrBudget(RUNTIME_isr_t isr, RUNTIME_isrBudget_t* stats)
+{
+    if (NULL == stats)
+    {
+        return RC_ERROR_NULL;
+    }
+    if (isr >= RUNTIME_ISRS)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    SuspendAllInterrupts();
+    stats->maxCycles = RUNTIME__isrBudget[isr].maxCycles;
+    stats->overruns = RUNTIME__isrBudget[isr].overruns;
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the cycles a task has run in total (wraps at 2^32).
+ *
+ * @param task Task identifier.
+ * @param cycles Pointer receiving the execution time in CPU cycles.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM.
+ */
+RC_t RUNTIME_GetTaskCycles(TaskType task, uint32_t* cycles)
+{
+    if (NULL == cycles)
+    {
+        return RC_ERROR_NULL;
+    }
+    if (task >= EE_MAX_TASK)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    *cycles = RUNTIME__taskCycles[task];
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Charges the running task's slice up to now.
+ *
+ * @param now Current cycle counter.
+ */
+static void RUNTIME__chargeTask(uint32_t now)
+{
+    TaskType task = RUNTIME__running;
+
+    if ((task >= 0) && (task < EE_MAX_TASK))
+    {
+        RUNTIME__taskCycles[task] += now - RUNTIME__taskStart;
+    }
+    RUNTIME__taskStart = now;
+}
+
+/**
+ * @brief Sums the window length, to be called with interrupts suspended.
+ *
+ * @return Cycles covered by the completed samples.
+ */
+static uint64_t RUNTIME__windowCycles(void)
+{
+    uint64_t total = 0;
+
+    for (uint8_t i = 0; i < RUNTIME__samplesValid; i++)
+    {
+        total += RUNTIME__window[i].total;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Converts busy cycles into a load.
+ *
+ * @param busy Busy cycles within the window.
+ * @param total Length of the window in cycles.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS or RC_ERROR_BUFFER_EMTPY if no sample is complete.
+ */
+static RC_t RUNTIME__permille(uint64_t busy, uint64_t total, uint16_t* permille)
+{
+    if (0 == total)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+
+    *permille = (uint16_t)((busy * RUNTIME__PERMILLE) / total);
+
+    return RC_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/**
+* \file runtime.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Per task and per ISR2 execution time accounting and CPU load
+*
+* Task time is taken in PreTaskHook/PostTaskHook, which the kernel calls on
+* every dispatch and on every preemption, so a task is only charged for the
+* cycles it really ran. The hooks are enabled in runtime_cfg.h. ISR2 bodies are bracketed by RUNTIME_IsrEnter() and
+* RUNTIME_IsrExit(): their time, including nesting, is charged to the ISR and
+* removed from the interrupted task. tsk_background never terminates and runs
+* at the lowest priority, its share is the idle time.
+*
+* Category 1 ISRs (isr_buttons) are not bracketed: they preempt the kernel and
+* the ISR2 accounting at any point, so they must not touch its state. Their
+* time is charged to whatever they interrupt, a task, an ISR2 or the idle
+* task. isr_buttons only runs on a button edge and takes well below one
+* permille of a sample.
+*
+* The load is a sliding window of RUNTIME_WINDOW_SAMPLES samples, each
+* RUNTIME_SAMPLE_MS long, advanced by RUNTIME_Tick() from the 1 ms systick.
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include "global.h"
+#include "ErikaOS_ee.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define RUNTIME_SAMPLE_MS           250     /**< Length of one sample [ms] */
+#define RUNTIME_WINDOW_SAMPLES      4       /**< Samples in the sliding window, window = 1 s */
+
+#define RUNTIME_REPORT              ON      /**< Periodic load report on UART from tsk_background */
+#define RUNTIME_REPORT_MS           5000    /**< Period of the load report [ms] */
+
+//####################### ENUMERATIONS
+
+/**
+ * @brief Accounted category 2 ISRs, category 1 ISRs are not accounted.
+ */
+typedef enum {
+    RUNTIME_ISR_SYSTICK,    /**< systick_handler */
+    RUNTIME_ISR_TIMER,      /**< isr_timer */
+    RUNTIME_ISRS            /**< Number of accounted ISRs */
+} RUNTIME_isr_t;
+
+/**
+ * @brief Execution budget statistics of an ISR2.
+ */
+typedef struct {
+    uint32_t maxCycles;     /**< Longest body observed, nested ISRs excluded */
+    uint16_t overruns;      /**< Bodies longer than the budget of budget_cfg.h */
+} RUNTIME_isrBudget_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class RUNTIME
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and clears all accounts.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t RUNTIME_Init(void);
+
+/**
+ * @brief Marks the start of an ISR2 body, first statement of the ISR.
+ *
+ * @return RC_SUCCESS, RC_ERROR_OVERRUN if the ISRs nest too deep (not accounted).
+ */
+RC_t RUNTIME_IsrEnter(void);
+
+/**
+ * @brief Marks the end of an ISR2 body, last statement of the ISR.
+ *
+ * The net execution time is checked against the ISR budget of budget_cfg.h.
+ *
+ * @param isr ISR to charge.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_INVALID_STATE without RUNTIME_IsrEnter().
+ */
+RC_t RUNTIME_IsrExit(RUNTIME_isr_t isr);
+
+/**
+ * @brief Advances the sliding window, to be called every 1 ms from systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t RUNTIME_Tick(void);
+
+/**
+ * @brief Returns the CPU load of a task over the sliding window.
+ *
+ * @param task Task identifier.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY before the first sample is complete.
+ */
+RC_t RUNTIME_GetTaskLoad(TaskType task, uint16_t* permille);
+
+/**
+ * @brief Returns the CPU load of an ISR2 over the sliding window.
+ *
+ * @param isr ISR identifier.
+ * @param permille Pointer receiving the load in 1/1000.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY before the first sample is complete.
+ */
+RC_t RUNTIME_GetIsrLoad(RUNTIME_isr_t isr, uint16_t* permille);
+
+/**
+ * @brief Returns the execution budget statistics of an ISR2.
+ *
+ * @param isr ISR identifier.
+ * @param stats Pointer receiving the statistics.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM.
+ */
+RC_t RUNTIME_GetIsrBudget(RUNTIME_isr_t isr, RUNTIME_isrBudget_t* stats);
+
+/**
+ * @brief Returns the cycles a task has run in total (wraps at 2^32).
+ *
+ * @param task Task identifier.
+ * @param cycles Pointer receiving the execution time in CPU cycles.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM.
+ */
+RC_t RUNTIME_GetTaskCycles(TaskType task, uint32_t* cycles);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* RUNTIME_H */
@@ -0,0 +1,133 @@
+/**
+* \file schedtab_cfg.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Schedule table configuration for the ErikaOS kernel
+*
+* Picked up by ErikaOS_eecfg.inc, so this file may only contain
+* pre-processor definitions: no types, no prototypes, no includes.
+* The initializers are expanded inside the kernel tables of ErikaOS_eecfg.c.
+*
+* sched_glower replaces the self re-arming one shot alarm of tsk_glower:
+* every step of RG_glowtable_1 is an expiry point which activates
+* tsk_glower, so the step timing comes from the counter and no longer
+* accumulates the task latency of each SetRelAlarm() call.
+* With the high resolution counter (hrcounter_cfg.h) the table runs on
+* cnt_hires, the offsets stay in ms and are scaled to its ticks.
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef SCHEDTAB_CFG_H
+#define SCHEDTAB_CFG_H
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define EE_AS_SCHEDULETABLES__
+
+#define EE_MAX_SCHEDULETABLE        1U      /**< Number of schedule tables */
+#define EE_SCHEDTAB_EXPIRY_POINTS   9U      /**< Expiry points of all tables */
+#define EE_SCHEDTAB_ACTIONS         9U      /**< Actions of all expiry points, appended after the alarm actions */
+
+//####################### IDENTIFIERS
+
+#define sched_glower                0U      /**< RGB glow choreography, one cycle of RG_glowtable_1 */
+
+#define SCHEDTAB_GLOWER_DURATION    2100U   /**< Sum of all timeInMS of RG_glowtable_1 [ms] */
+
+#ifdef EE_HR_COUNTER__
+#define SCHEDTAB_COUNTER            cnt_hires
+#define SCHEDTAB_TICKS_PER_MS       HRCOUNTER_TICKS_PER_MS
+#else
+#define SCHEDTAB_COUNTER            cnt_systick
+#define SCHEDTAB_TICKS_PER_MS       1U      /**< cnt_systick ticks every 1 ms */
+#endif
+
+//####################### KERNEL TABLE INITIALIZERS
+
+/* Appended to the alarm counter objects: starts with a comma */
+#define EE_SCHEDTAB_COUNTER_OBJECTS \
+    ,{SCHEDTAB_COUNTER, sched_glower, EE_SCHEDULETABLE }
+
+/* Appended to the alarm actions (index EE_MAX_ALARM + n): starts with a comma */
+#define SCHEDTAB_ACTIVATE_GLOWER \
+    ,{EE_ACTION_TASK, tsk_glower, 0U, (EE_VOID_CALLBACK)NULL, (EE_TYPECOUNTER)-1 }
+
+#define EE_SCHEDTAB_ACTIONS_ROM \
+    SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER \
+    SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER \
+    SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER SCHEDTAB_ACTIVATE_GLOWER
+
+/* {offset, first action, last action, max shorten, max lengthen}
+ * Offsets are the running sum of timeInMS of RG_glowtable_1 */
+#define SCHEDTAB_EXPIRY_POINT(offset, n) \
+    {((offset) * SCHEDTAB_TICKS_PER_MS), (EE_MAX_ALARM + (n)), (EE_MAX_ALARM + (n)), 0U, 0U }
+
+#define EE_SCHEDTAB_EXPIRY_POINTS_ROM \
+    SCHEDTAB_EXPIRY_POINT(   0U, 0U), \
+    SCHEDTAB_EXPIRY_POINT( 500U, 1U), \
+    SCHEDTAB_EXPIRY_POINT(1000U, 2U), \
+    SCHEDTAB_EXPIRY_POINT(1500U, 3U), \
+    SCHEDTAB_EXPIRY_POINT(1600U, 4U), \
+    SCHEDTAB_EXPIRY_POINT(1700U, 5U), \
+    SCHEDTAB_EXPIRY_POINT(1800U, 6U), \
+    SCHEDTAB_EXPIRY_POINT(1900U, 7U), \
+    SCHEDTAB_EXPIRY_POINT(2000U, 8U)
+
+/* {first expiry point, last expiry point, sync, duration, precision, repeated} */
+#define EE_SCHEDTAB_ROM \
+    {0U, 8U, EE_SCHEDTABLE_SYNC_NONE, (SCHEDTAB_GLOWER_DURATION * SCHEDTAB_TICKS_PER_MS), 0U, 1U }
+
+/* {status, position, deviation, next table} */
+#define EE_SCHEDTAB_RAM \
+    {SCHEDULETABLE_STOPPED, INVALID_SCHEDULETABLE_POSITION, 0U, INVALID_SCHEDULETABLE }
+
+#endif /* SCHEDTAB_CFG_H */
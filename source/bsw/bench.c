@@ -0,0 +1,554 @@
+/**
+* \file bench.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Cycle and instruction counting microbenchmarks on the target
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "bench.h"
+#include "cycle.h"
+#if (BENCH_SUITE == ON)
+#include "swtimer.h"
+#include "delay.h"
+#include "seven.h"
+#include "PWM.h"
+#include "fmt.h"
+#include "prng.h"
+#include <stdlib.h>
+#endif
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/** DWT_CTRL enables of the CPI, exception, sleep, load/store and fold counters */
+#define BENCH__DWT_CTRL_EVENTS      0x003E0000u
+
+#define BENCH__CALIBRATION_RUNS     64      /**< Samples of the empty operation */
+
+#if (BENCH_SUITE == ON)
+#define BENCH__ITERATIONS           1000    /**< Samples per operation of the suite */
+#define BENCH__TIMERS               24      /**< Most software timers active at a time */
+#define BENCH__EXPIRE_MS            200     /**< Time the periodic timers are left to expire */
+#define BENCH__FAR_MS               60000   /**< Delay of the timer restarted by the insert benchmark */
+#define BENCH__RANDOM_BOUND         3U      /**< Bound of the round delay of the game, not a power of two */
+#endif
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Cost of one sample.
+ */
+typedef struct {
+    uint32_t cycles;        /**< Cycle counter difference */
+    uint32_t instructions;  /**< Derived instruction count, valid below BENCH_MAX_COUNTED_CYCLES */
+} BENCH__sample_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static boolean_t BENCH__ready = FALSE;
+
+/** Cost of measuring the empty operation */
+static BENCH__sample_t BENCH__overhead = {0, 0};
+
+#if (BENCH_SUITE == ON)
+static boolean_t BENCH__suiteReady = FALSE;
+static TaskType BENCH__task;                    /**< Woken up by the context switch benchmark */
+static EventMaskType BENCH__idle;               /**< Event BENCH__task does not wait for */
+static EventMaskType BENCH__probe;              /**< Event BENCH__task waits for and drops */
+
+static SWTIMER_t BENCH__timers[BENCH__TIMERS];
+static uint8_t BENCH__timerIndex = 0;           /**< Timer restarted by BENCH__timerStart() */
+
+/** Cost of SWTIMER_Expire() and callbacks run, accumulated by isr_timer */
+static volatile uint32_t BENCH__expireCycles = 0;
+static volatile uint32_t BENCH__expired = 0;
+static volatile uint32_t BENCH__tickCycles = 0;     /**< CounterTick() in systick_handler since the last report */
+static volatile uint32_t BENCH__tickMax = 0;
+static volatile uint32_t BENCH__ticks = 0;
+
+/** Own generator, draws from the game generator would change the rounds and break a replay */
+static PRNG_t BENCH__prng;
+#endif
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void BENCH__measure(BENCH_op_t op, BENCH__sample_t* sample);
+static void BENCH__empty(void);
+
+#if (BENCH_SUITE == ON)
+static void BENCH__setEvent(void);
+static void BENCH__contextSwitch(void);
+static void BENCH__criticalSection(void);
+static void BENCH__sevenGet(void);
+static void BENCH__pwmWrite(void);
+static void BENCH__format(void);
+static void BENCH__random(void);
+static void BENCH__timerStart(void);
+static void BENCH__timerCancel(void);
+static void BENCH__timerNop(void* context);
+static void BENCH__reportOperations(void);
+static void BENCH__reportTimers(void);
+static void BENCH__reportCounterTick(void);
+#endif
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Enables the DWT counters and calibrates the measurement overhead.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_Init(void)
+{
+    CYCLE_Init();
+    CY_SET_REG32(CYREG_DWT_CTRL, CY_GET_REG32(CYREG_DWT_CTRL) | BENCH__DWT_CTRL_EVENTS);
+    
+    /* The fastest run of the empty operation is the pure measurement cost */
+    BENCH__sample_t sample;
+    
+    BENCH__overhead.cycles = 0xFFFFFFFFu;
+    for (uint8_t i = 0; i < BENCH__CALIBRATION_RUNS; ++i)
+    {
+        BENCH__measure(BENCH__empty, &sample);
+        if (sample.cycles < BENCH__overhead.cycles)
+        {
+            BENCH__overhead = sample;
+        }
+    }
+    
+    BENCH__ready = TRUE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Measures an operation.
+ *
+ * @param op Operation, called iterations times.
+ * @param iterations Number of samples, valid range 1...65535.
+ * @param result Pointer receiving the result.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_ZERO,
+ *         RC_ERROR_INVALID_STATE if BENCH_Init() was not called.
+ */
+RC_t BENCH_Run(BENCH_op_t op, uint16_t iterations, BENCH_result_t* result)
+{
+    if ((op == NULL) || (result == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (iterations == 0)
+    {
+        return RC_ERROR_ZERO;
+    }
+    
+    if (BENCH__ready == FALSE)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    BENCH__sample_t sample;
+    BENCH__sample_t fastest = {0xFFFFFFFFu, 0};
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    
+    for (uint16_t i = 0; i < iterations; ++i)
+    {
+        BENCH__measure(op, &sample);
+        sum += sample.cycles;
+        if (sample.cycles < fastest.cycles)
+        {
+            fastest = sample;
+        }
+        if (sample.cycles > max)
+        {
+            max = sample.cycles;
+        }
+    }
+    
+    /* Noise may make a sample cheaper than the calibration */
+    uint32_t avg = (uint32_t)(sum / iterations);
+    
+    result->minCycles = (fastest.cycles > BENCH__overhead.cycles) ? (fastest.cycles - BENCH__overhead.cycles) : 0;
+    result->avgCycles = (avg > BENCH__overhead.cycles) ? (avg - BENCH__overhead.cycles) : 0;
+    result->maxCycles = (max > BENCH__overhead.cycles) ? (max - BENCH__overhead.cycles) : 0;
+    result->instructions = BENCH_UNKNOWN;
+    
+    /* Below the range no event counter can have wrapped */
+    if ((fastest.cycles < BENCH_MAX_COUNTED_CYCLES) && (fastest.instructions >= BENCH__overhead.instructions))
+    {
+        result->instructions = (uint16_t)(fastest.instructions - BENCH__overhead.instructions);
+    }
+
+    return RC_SUCCESS;
+}
+
+#if (BENCH_SUITE == ON)
+/**
+ * @brief Calls BENCH_Init() and sets up the suite.
+ *
+ * @param task Task of the highest priority, it waits for probe and drops it.
+ * @param idle Event the task does not wait for, SetEvent() without a context switch.
+ * @param probe Event which wakes up the task without further action.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM if idle and probe are not distinct single events.
+ */
+RC_t BENCH_SuiteInit(TaskType task, EventMaskType idle, EventMaskType probe)
+{
+    // One bit each, a shared bit would wake the task in the SetEvent() benchmark
+    if ((idle == 0) || ((idle & (idle - 1U)) != 0) ||
+        (probe == 0) || ((probe & (probe - 1U)) != 0) || (idle == probe))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    BENCH_Init();
+    PRNG_Create(&BENCH__prng, 0);
+
+    BENCH__task = task;
+    BENCH__idle = idle;
+    BENCH__probe = probe;
+    BENCH__suiteReady = TRUE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Runs the suite and prints it on UART, takes some 100 ms.
+ *
+ * @return RC_SUCCESS, RC_ERROR_INVALID_STATE before BENCH_SuiteInit().
+ */
+RC_t BENCH_SuiteReport(void)
+{
+    if (BENCH__suiteReady == FALSE)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+
+    BENCH__reportOperations();
+    BENCH__reportTimers();
+    BENCH__reportCounterTick();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Adds one run of SWTIMER_Expire(), called by isr_timer.
+ *
+ * @param cycles Cost of SWTIMER_Expire() including the callbacks.
+ * @param expired Callbacks run.
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_NoteExpire(uint32_t cycles, uint8_t expired)
+{
+    BENCH__expireCycles += cycles;
+    BENCH__expired += expired;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Adds one CounterTick(), called by systick_handler.
+ *
+ * @param cycles Cost of CounterTick() including the expired alarms.
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_NoteTick(uint32_t cycles)
+{
+    BENCH__tickCycles += cycles;
+    BENCH__tickMax = (cycles > BENCH__tickMax) ? cycles : BENCH__tickMax;
+    ++BENCH__ticks;
+
+    return RC_SUCCESS;
+}
+#endif
+
+/**
+ * @brief Runs an operation once between two snapshots of the DWT counters.
+ *
+ * @param op Operation.
+ * @param sample Pointer receiving the cost.
+ */
+static void BENCH__measure(BENCH_op_t op, BENCH__sample_t* sample)
+{
+    /* The event counters are read first and last, so the cycle counter
+     * brackets the operation as tightly as possible */
+    uint8_t cpi = (uint8_t)CY_GET_REG32(CYREG_DWT_CPI_COUNT);
+    uint8_t exc = (uint8_t)CY_GET_REG32(CYREG_DWT_EXC_OVHD_COUNT);
+    uint8_t sleep = (uint8_t)CY_GET_REG32(CYREG_DWT_SLEEP_COUNT);
+    uint8_t lsu = (uint8_t)CY_GET_REG32(CYREG_DWT_LSU_COUNT);
+    uint8_t fold = (uint8_t)CY_GET_REG32(CYREG_DWT_FOLD_COUNT);
+    uint32_t start = CYCLE_NOW();
+    
+    op();
+    
+    sample->cycles = CYCLE_SINCE(start);
+    cpi = (uint8_t)CY_GET_REG32(CYREG_DWT_CPI_COUNT) - cpi;
+    exc = (uint8_t)CY_GET_REG32(CYREG_DWT_EXC_OVHD_COUNT) - exc;
+    sleep = (uint8_t)CY_GET_REG32(CYREG_DWT_SLEEP_COUNT) - sleep;
+    lsu = (uint8_t)CY_GET_REG32(CYREG_DWT_LSU_COUNT) - lsu;
+    fold = (uint8_t)CY_GET_REG32(CYREG_DWT_FOLD_COUNT) - fold;
+    
+    /* Instructions = cycles - stall cycles + folded instructions */
+    sample->instructions = sample->cycles + fold - cpi - exc - sleep - lsu;
+}
+
+/**
+ * @brief Operation of the calibration.
+ */
+static void BENCH__empty(void)
+{
+}
+
+#if (BENCH_SUITE == ON)
+/**
+ * @brief Kernel service without a context switch, the task does not wait for the idle event.
+ */
+static void BENCH__setEvent(void)
+{
+    SetEvent(BENCH__task, BENCH__idle);
+}
+
+/**
+ * @brief Context switch to the task and back.
+ *
+ * The task has the highest priority, wakes up on the probe event, drops it
+ * and waits again. The sample holds SetEvent(), both switches, GetEvent(),
+ * ClearEvent() and WaitEvent().
+ */
+static void BENCH__contextSwitch(void)
+{
+    SetEvent(BENCH__task, BENCH__probe);
+}
+
+/**
+ * @brief Entry and exit of a kernel critical section.
+ */
+static void BENCH__criticalSection(void)
+{
+    SuspendOSInterrupts();
+    ResumeOSInterrupts();
+}
+
+/**
+ * @brief Seven segment driver, read path so the game display is not disturbed.
+ */
+static void BENCH__sevenGet(void)
+{
+    sint8_t value = 0;
+    SEVEN_Get(SEVEN_0, &value);
+}
+
+/**
+ * @brief PWM driver, the duty cycle written is the one read.
+ */
+static void BENCH__pwmWrite(void)
+{
+    PWM_Write(Led_Red, PWM_Read(Led_Red));
+}
+
+/**
+ * @brief Decimal formatting of the longest uint32_t.
+ */
+static void BENCH__format(void)
+{
+    char_t buffer[FMT_U32_SIZE];
+    FMT_U32(4294967295u, buffer, sizeof(buffer), NULL);
+}
+
+/**
+ * @brief Unbiased random number as drawn for the round delay, from the own generator.
+ */
+static void BENCH__random(void)
+{
+    uint32_t value = 0;
+    PRNG_Draw(&BENCH__prng, BENCH__RANDOM_BOUND, &value);
+}
+
+/**
+ * @brief Software timer insert, restarts one timer far ahead while the others are pending.
+ */
+static void BENCH__timerStart(void)
+{
+    SWTIMER_Start(&BENCH__timers[BENCH__timerIndex], BENCH__FAR_MS, 0);
+}
+
+/**
+ * @brief Software timer cancel, constant time whatever is pending.
+ */
+static void BENCH__timerCancel(void)
+{
+    SWTIMER_Cancel(&BENCH__timers[0]);
+}
+
+/**
+ * @brief Callback of the benchmark timers, only the expiry is measured.
+ *
+ * @param context Not used.
+ */
+static void BENCH__timerNop(void* context)
+{
+}
+
+/**
+ * @brief Runs all operations and prints min/avg/max cycles and instructions on UART.
+ *
+ * min is the cost of the operation, avg and max include preemptions by the
+ * game. The instruction count is only known for operations below
+ * BENCH_MAX_COUNTED_CYCLES. The context switch is measured there and back,
+ * SetEvent() alone is the part without a switch.
+ */
+static void BENCH__reportOperations(void)
+{
+    static const struct {
+        const char_t* name;
+        BENCH_op_t op;
+    } operations[] = {
+        {"SetEvent", BENCH__setEvent},
+        {"SetEvent+switch+WaitEvent+switch", BENCH__contextSwitch},
+        {"Suspend/ResumeOSInterrupts", BENCH__criticalSection},
+        {"SEVEN_Get", BENCH__sevenGet},
+        {"PWM_Read/Write", BENCH__pwmWrite},
+        {"FMT_U32", BENCH__format},
+        {"PRNG_Draw", BENCH__random},
+        {"SWTIMER_Cancel", BENCH__timerCancel}
+    };
+    char_t buffer[FMT_U32_SIZE];
+    BENCH_result_t result;
+
+    UART_Logs_PutString("\nBenchmarks [cycles min/avg/max, instructions]\n");
+    for (uint8_t i = 0; i < sizeof(operations) / sizeof(operations[0]); ++i)
+    {
+        if (BENCH_Run(operations[i].op, BENCH__ITERATIONS, &result) != RC_SUCCESS)
+        {
+            continue;
+        }
+        UART_Logs_PutString(operations[i].name);
+        UART_Logs_PutString(" ");
+        UART_Logs_PutString(utoa(result.minCycles, buffer, 10));
+        UART_Logs_PutString("/");
+        UART_Logs_PutString(utoa(result.avgCycles, buffer, 10));
+        UART_Logs_PutString("/");
+        UART_Logs_PutString(utoa(result.maxCycles, buffer, 10));
+        UART_Logs_PutString(" ");
+        UART_Logs_PutString((result.instructions == BENCH_UNKNOWN) ? "-" : utoa(result.instructions, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+}
+
+/**
+ * @brief Measures software timer insert and expiry over the number of active timers.
+ *
+ * n periodic timers of 1...4 ms are left to expire in isr_timer for
+ * BENCH__EXPIRE_MS, the expiry cost per timer includes the heap update,
+ * the callback and reprogramming the Counter. While they keep running, the
+ * insert benchmark restarts the last of them far ahead. Prints n, insert
+ * min/avg/max and the mean expiry on UART, then the periodic timers lost.
+ */
+static void BENCH__reportTimers(void)
+{
+    static const uint8_t active[] = {1, 8, BENCH__TIMERS};
+    char_t buffer[FMT_U32_SIZE];
+    BENCH_result_t result;
+
+    UART_Logs_PutString("\nSoftware timers [n, insert cycles min/avg/max, expire cycles]\n");
+    for (uint8_t i = 0; i < sizeof(active) / sizeof(active[0]); ++i)
+    {
+        uint8_t n = active[i];
+
+        SuspendAllInterrupts();
+        BENCH__expireCycles = 0;
+        BENCH__expired = 0;
+        ResumeAllInterrupts();
+        for (uint8_t t = 0; t < n; ++t)
+        {
+            SWTIMER_Create(&BENCH__timers[t], BENCH__timerNop, NULL);
+            SWTIMER_Start(&BENCH__timers[t], 1U + (t % 4U), 1U + (t % 4U));
+        }
+        DELAY_MS(BENCH__EXPIRE_MS);
+
+        SuspendAllInterrupts();
+        uint32_t cycles = BENCH__expireCycles;
+        uint32_t expired = BENCH__expired;
+        ResumeAllInterrupts();
+
+        BENCH__timerIndex = n - 1U;
+        RC_t rc = BENCH_Run(BENCH__timerStart, BENCH__ITERATIONS, &result);
+        for (uint8_t t = 0; t < n; ++t)
+        {
+            SWTIMER_Cancel(&BENCH__timers[t]);
+        }
+        if ((rc != RC_SUCCESS) || (expired == 0))
+        {
+            continue;
+        }
+
+        UART_Logs_PutString(utoa(n, buffer, 10));
+        UART_Logs_PutString(" ");
+        UART_Logs_PutString(utoa(result.minCycles, buffer, 10));
+        UART_Logs_PutString("/");
+        UART_Logs_PutString(utoa(result.avgCycles, buffer, 10));
+        UART_Logs_PutString("/");
+        UART_Logs_PutString(utoa(result.maxCycles, buffer, 10));
+        UART_Logs_PutString(" ");
+        UART_Logs_PutString(utoa(cycles / expired, buffer, 10));
+        UART_Logs_PutString("\n");
+    }
+
+    uint16_t lost = 0;
+    SWTIMER_GetLost(&lost);
+    UART_Logs_PutString("Periodic timers lost: ");
+    UART_Logs_PutString(utoa(lost, buffer, 10));
+    UART_Logs_PutString("\n");
+}
+
+/**
+ * @brief Prints mean and max cycles of CounterTick(cnt_systick) in systick_handler on UART.
+ *
+ * Taken over all ticks since the last report, with the alarms of the running
+ * game. A tick which expires an alarm includes activating its task.
+ */
+static void BENCH__reportCounterTick(void)
+{
+    char_t buffer[FMT_U32_SIZE];
+
+    SuspendAllInterrupts();
+    uint32_t cycles = BENCH__tickCycles;
+    uint32_t max = BENCH__tickMax;
+    uint32_t ticks = BENCH__ticks;
+    BENCH__tickCycles = 0;
+    BENCH__tickMax = 0;
+    BENCH__ticks = 0;
+    ResumeAllInterrupts();
+
+    if (ticks == 0)
+    {
+        return;
+    }
+    UART_Logs_PutString("\nCounterTick [cycles avg/max] ");
+    UART_Logs_PutString(utoa(cycles / ticks, buffer, 10));
+    UART_Logs_PutString("/");
+    UART_Logs_PutString(utoa(max, buffer, 10));
+    UART_Logs_PutString("\n");
+}
+#endif
@@ -0,0 +1,194 @@
+/**
+* \file bench.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Cycle and instruction counting microbenchmarks on the target
+*
+* An operation is called repeatedly between two snapshots of the DWT
+* counters. Cycles come from the cycle counter. Instructions are derived
+* from the DWT event counters (cycles minus the extra cycles of multi cycle,
+* load/store, exception and sleep phases, plus folded instructions). These
+* counters are only 8 bit wide, so the instruction count is only available
+* for operations shorter than BENCH_MAX_COUNTED_CYCLES.
+* The overhead of the measurement itself is calibrated once and subtracted.
+* Interrupts stay enabled so that OS services may be measured. The minimum
+* is the cost of the operation, the maximum includes preemptions.
+*
+* With BENCH_SUITE tsk_background runs a fixed suite of kernel services and
+* BSW drivers every BENCH_SUITE_PERIOD_MS while the game keeps running, and
+* prints it on UART_Logs with the software timer costs over the number of
+* active timers and the cost of CounterTick() in systick_handler.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "global.h"
+#include "ErikaOS_ee.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define BENCH_SUITE                 OFF     /**< ON: tsk_background runs the kernel and BSW microbenchmarks */
+#define BENCH_SUITE_PERIOD_MS       5000    /**< Pause between two suite reports [ms] */
+
+#define BENCH_MAX_COUNTED_CYCLES    256     /**< Range of the 8 bit DWT event counters */
+#define BENCH_UNKNOWN               0xFFFFu /**< Instruction count of longer operations */
+
+//####################### TYPES
+
+/** Operation under test, called once per sample */
+typedef void (*BENCH_op_t)(void);
+
+//####################### STRUCTURES
+
+/**
+ * @brief Result of one benchmark, measurement overhead removed.
+ */
+typedef struct {
+    uint32_t minCycles;         /**< Cost of the operation */
+    uint32_t avgCycles;         /**< Mean including preemptions */
+    uint32_t maxCycles;         /**< Worst sample including preemptions */
+    uint16_t instructions;      /**< Instructions of the fastest sample or BENCH_UNKNOWN */
+} BENCH_result_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class BENCH
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Enables the DWT counters and calibrates the measurement overhead.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_Init(void);
+
+/**
+ * @brief Measures an operation.
+ *
+ * @param op Operation, called iterations times.
+ * @param iterations Number of samples, valid range 1...65535.
+ * @param result Pointer receiving the result.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_ZERO,
+ *         RC_ERROR_INVALID_STATE if BENCH_Init() was not called.
+ */
+RC_t BENCH_Run(BENCH_op_t op, uint16_t iterations, BENCH_result_t* result);
+
+/**
+ * @brief Calls BENCH_Init() and sets up the suite.
+ *
+ * SWTIMER_Init() must have been called before.
+ *
+ * @param task Task of the highest priority, it waits for probe and drops it.
+ * @param idle Event the task does not wait for, SetEvent() without a context switch.
+ * @param probe Event which wakes up the task without further action.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM if idle and probe are not distinct single events.
+ */
+RC_t BENCH_SuiteInit(TaskType task, EventMaskType idle, EventMaskType probe);
+
+/**
+ * @brief Runs the suite and prints it on UART, takes some 100 ms.
+ *
+ * Prints min/avg/max cycles and instructions of every operation, the
+ * software timer insert and expiry costs and the CounterTick() costs since
+ * the previous report.
+ *
+ * @return RC_SUCCESS, RC_ERROR_INVALID_STATE before BENCH_SuiteInit().
+ */
+RC_t BENCH_SuiteReport(void);
+
+/**
+ * @brief Adds one run of SWTIMER_Expire(), called by isr_timer.
+ *
+ * @param cycles Cost of SWTIMER_Expire() including the callbacks.
+ * @param expired Callbacks run.
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_NoteExpire(uint32_t cycles, uint8_t expired);
+
+/**
+ * @brief Adds one CounterTick(), called by systick_handler.
+ *
+ * @param cycles Cost of CounterTick() including the expired alarms.
+ * @return RC_SUCCESS
+ */
+RC_t BENCH_NoteTick(uint32_t cycles);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* BENCH_H */
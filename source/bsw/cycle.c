@@ -0,0 +1,59 @@
+/**
+* \file cycle.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief CPU cycle counter based on the Cortex-M3 DWT unit
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "cycle.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define CYCLE__DEMCR                CYREG_CORE_DBG_EXC_MON_CTL  /**< Debug exception and monitor control */
+#define CYCLE__DEMCR_TRCENA         0x01000000u                 /**< Enables DWT and ITM */
+#define CYCLE__DWT_CTRL_CYCCNTENA   0x00000001u                 /**< Enables the cycle counter */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Enables the trace unit and starts the DWT cycle counter.
+ *
+ * May be called several times, the counter is not reset.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t CYCLE_Init(void)
+{
+    CY_SET_REG32(CYCLE__DEMCR, CY_GET_REG32(CYCLE__DEMCR) | CYCLE__DEMCR_TRCENA);
+    CY_SET_REG32(CYREG_DWT_CTRL, CY_GET_REG32(CYREG_DWT_CTRL) | CYCLE__DWT_CTRL_CYCCNTENA);
+
+    return RC_SUCCESS;
+}
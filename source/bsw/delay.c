@@ -0,0 +1,174 @@
+/**
+* \file delay.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Delays which suspend the calling task instead of spinning
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "delay.h"
+#include "swtimer.h"
+#include "timebase.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/* DELAY_Ms() relies on WaitEvent() refusing basic tasks */
+#ifndef __OO_EXTENDED_STATUS__
+#error "DELAY_Ms() needs the extended status of the ErikaOS customizer"
+#endif
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Delay timer of one task.
+ */
+typedef struct {
+    SWTIMER_t timer;                /**< One shot timer of the running delay */
+    TaskType task;                  /**< Task woken up on expiry */
+} DELAY__waiter_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static DELAY__waiter_t DELAY__waiters[EE_MAX_TASK];
+static volatile boolean_t DELAY__ready = FALSE;     /**< DELAY_Init() was called, the time base runs */
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void DELAY__expired(void* context);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Sets up one delay timer per task.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t DELAY_Init(void)
+{
+    for (TaskType task = 0; task < EE_MAX_TASK; task++)
+    {
+        DELAY__waiters[task].task = task;
+        SWTIMER_Create(&DELAY__waiters[task].timer, DELAY__expired, &DELAY__waiters[task]);
+    }
+    DELAY__ready = TRUE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Suspends the calling extended task for a number of milliseconds.
+ *
+ * Busy waits in CyDelay() before DELAY_Init(), in an ISR and in a basic task.
+ *
+ * @param ms Delay [ms], valid range 0...4294967295, 0 returns at once.
+ * @return RC_SUCCESS or the error of SWTIMER_Start().
+ */
+RC_t DELAY_Ms(uint32_t ms)
+{
+    TaskType task = INVALID_TASK;
+
+    if (ms == 0)
+    {
+        return RC_SUCCESS;
+    }
+
+    // In an ISR GetTaskID() returns the interrupted task, check the exception number first
+    if ((DELAY__ready == FALSE) || (__get_IPSR() != 0) ||
+        (GetTaskID(&task) != E_OK) || (task == INVALID_TASK) || (task >= EE_MAX_TASK))
+    {
+        CyDelay(ms);
+        return RC_SUCCESS;
+    }
+
+    DELAY__waiter_t* waiter = &DELAY__waiters[task];
+    RC_t result = SWTIMER_Start(&waiter->timer, ms, 0);
+
+    if (result != RC_SUCCESS)
+    {
+        return result;
+    }
+
+    // An expiry before the wait leaves the event set, WaitEvent() then returns at once
+    if (WaitEvent(DELAY_EVENT) != E_OK)
+    {
+        // Basic task, it must not be woken up later on and keeps the CPU instead
+        SWTIMER_Cancel(&waiter->timer);
+        CyDelay(ms);
+        return RC_SUCCESS;
+    }
+    ClearEvent(DELAY_EVENT);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Spins on the time base for a number of microseconds.
+ *
+ * Waits longer than DELAY_SPIN_MAX_US wait the whole milliseconds in DELAY_Ms()
+ * and spin the rest. Spins in CyDelayUs() before DELAY_Init().
+ *
+ * @param us Delay [us], valid range 0...65535.
+ * @return RC_SUCCESS or the error of DELAY_Ms().
+ */
+RC_t DELAY_Us(uint16_t us)
+{
+    if (DELAY__ready == FALSE)
+    {
+        CyDelayUs(us);
+        return RC_SUCCESS;
+    }
+
+    // The time base counts at the nominal bus clock whatever the CPU clock is, polled without a lock
+    uint32_t start = TIMEBASE_Now32();
+    uint32_t duration = (uint32_t)us * TIMEBASE_CYCLES_PER_US;
+
+    // The timer never expires early, only what it left of the last millisecond is spun
+    if (us > DELAY_SPIN_MAX_US)
+    {
+        RC_t result = DELAY_Ms(us / 1000U);
+
+        if (result != RC_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    while ((uint32_t)(TIMEBASE_Now32() - start) < duration)
+    {
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Software timer callback, wakes up the delayed task.
+ *
+ * @param context Waiter of the task.
+ */
+static void DELAY__expired(void* context)
+{
+    DELAY__waiter_t* waiter = (DELAY__waiter_t*)context;
+
+    SetEvent(waiter->task, DELAY_EVENT);
+}
@@ -0,0 +1,150 @@
+/**
+* \file delay.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Delays which suspend the calling task instead of spinning
+*
+* DELAY_Ms() arms a one shot software timer of the calling task and waits
+* for DELAY_EVENT, which the timer sets from isr_timer. The CPU is free for
+* all other tasks meanwhile. Only extended tasks can wait for an event,
+* before DELAY_Init(), in an ISR and in a basic task it busy waits instead.
+*
+* DELAY_Us() spins on the time base, so unlike CyDelayUs() it does not
+* depend on cydelay_freq_khz and stays exact while the governor changes the
+* CPU clock. Waits longer than one systick leave the whole milliseconds to
+* DELAY_Ms() and only spin the rest.
+*
+* #DELAY_MS and #DELAY_US of global.h map to both functions.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef DELAY_H
+#define DELAY_H
+
+#include "global.h"
+#include "ErikaOS_ee.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define DELAY_EVENT                 0x80U   /**< Event of the delay timers, reserved: bit 7 is Event_8 of the customizer */
+#define DELAY_SPIN_MAX_US           1000U   /**< Longest wait of DELAY_Us() on the time base (one systick) [us] */
+
+/* The customizer assigns the event bits in order, Event_8 would share DELAY_EVENT */
+#if (EE_MAX_EVENT > 7)
+#error "DELAY_EVENT is Event_8 of the ErikaOS customizer, configure at most 7 events"
+#endif
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class DELAY
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Sets up one delay timer per task.
+ *
+ * SWTIMER_Init() must have been called before.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t DELAY_Init(void);
+
+/**
+ * @brief Suspends the calling extended task for a number of milliseconds.
+ *
+ * Other events of the task stay pending and are seen by its next WaitEvent().
+ * Where no task can wait, i.e. before DELAY_Init(), in an ISR and in a basic
+ * task, it busy waits in CyDelay() like DELAY_MS without an OS.
+ *
+ * @param ms Delay [ms], valid range 0...4294967295, 0 returns at once.
+ * @return RC_SUCCESS or the error of SWTIMER_Start().
+ */
+RC_t DELAY_Ms(uint32_t ms);
+
+/**
+ * @brief Spins on the time base for a number of microseconds.
+ *
+ * May be called from any task or ISR. Up to DELAY_SPIN_MAX_US the calling
+ * context keeps the CPU. Longer waits suspend an extended task for the whole
+ * milliseconds in DELAY_Ms() and spin the rest. Waits before DELAY_Init()
+ * spin in CyDelayUs() instead.
+ *
+ * @param us Delay [us], valid range 0...65535.
+ * @return RC_SUCCESS or the error of DELAY_Ms().
+ */
+RC_t DELAY_Us(uint16_t us);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* DELAY_H */
@@ -0,0 +1,453 @@
+/**
+* \file dma.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief DMA service layer on top of CyDmac
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "dma.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Runtime data of one managed channel.
+ */
+typedef struct {
+    boolean_t     inUse;                            /**< Slot is allocated */
+    boolean_t     running;                          /**< Channel is enabled */
+    boolean_t     chainReady;                       /**< DMA_ChainFinish() was called */
+    boolean_t     pingPong;                         /**< Chain was built by DMA_PingPong() */
+    DMA_chainMode_t mode;                           /**< Termination of the finished chain */
+    uint8_t       channel;                          /**< Hardware channel */
+    uint8_t       tdCount;                          /**< Number of reserved TDs */
+    uint8_t       tdUsed;                           /**< Number of TDs in the current chain */
+    uint8_t       td[DMA_MAX_TD_PER_CHANNEL];       /**< Reserved TDs */
+    uint8_t       tdConfig[DMA_MAX_TD_PER_CHANNEL]; /**< Flags of the chained TDs */
+    uint16_t      tdLength[DMA_MAX_TD_PER_CHANNEL]; /**< Byte count of the chained TDs */
+    volatile sint8_t readyBuffer;                   /**< Last completed ping-pong half, -1 = none */
+    TaskType      task;                             /**< Task to notify on completion */
+    EventMaskType event;                            /**< Event to set on completion, 0 = none */
+} DMA__channel_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static DMA__channel_t DMA__channels[DMA_MAX_CHANNELS];
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static DMA__channel_t* DMA__get(DMA_handle_t handle);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Opens a channel and reserves its TDs from the global TD pool.
+ *
+ * @param config Channel configuration, must not be NULL.
+ * @param handle Pointer receiving the handle of the opened channel.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM for invalid configuration,
+ *         RC_ERROR_MEMORY if no channel slot or not enough TDs are free.
+ */
+RC_t DMA_Open(const DMA_config_t* config, DMA_handle_t* handle)
+{
+    if ((config == NULL) || (handle == NULL) || (config->tdCount == 0) ||
+        (config->tdCount > DMA_MAX_TD_PER_CHANNEL) || (config->channel >= CY_DMA_NUMBEROF_CHANNELS))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    *handle = DMA_INVALID_HANDLE;
+
+    /* Find a free slot */
+    uint8_t slot = 0;
+    while ((slot < DMA_MAX_CHANNELS) && (DMA__channels[slot].inUse == TRUE))
+    {
+        ++slot;
+    }
+
+    if ((slot == DMA_MAX_CHANNELS) || (CyDmaTdFreeCount() < config->tdCount))
+    {
+        return RC_ERROR_MEMORY;
+    }
+
+    DMA__channel_t* ch = &DMA__channels[slot];
+
+    /* Reserve the TDs of this channel up front */
+    for (uint8_t i = 0; i < config->tdCount; ++i)
+    {
+        ch->td[i] = CyDmaTdAllocate();
+    }
+
+    ch->inUse = TRUE;
+    ch->running = FALSE;
+    ch->chainReady = FALSE;
+    ch->pingPong = FALSE;
+    ch->mode = DMA_CHAIN_SINGLE;
+    ch->channel = config->channel;
+    ch->tdCount = config->tdCount;
+    ch->tdUsed = 0;
+    ch->readyBuffer = -1;
+    ch->event = 0;
+
+    /* Burst setup and the trigger lines the fitter routed to this channel */
+    CyDmaChSetConfiguration(ch->channel, config->burstCount, config->requestPerBurst,
+                            config->termout0, config->termout1, config->termin);
+    CyDmaChSetExtendedAddress(ch->channel, config->upperSrcAddress, config->upperDstAddress);
+
+    *handle = slot;
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Stops a channel and returns its TDs to the global TD pool.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM for an unknown handle.
+ */
+RC_t DMA_Close(DMA_handle_t handle)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    DMA_Stop(handle);
+
+    for (uint8_t i = 0; i < ch->tdCount; ++i)
+    {
+        CyDmaTdFree(ch->td[i]);
+    }
+
+    ch->inUse = FALSE;
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Discards the chain built so far, the reserved TDs stay with the channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_BUSY if the channel is running.
+ */
+RC_t DMA_ChainReset(DMA_handle_t handle)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    if (ch->running == TRUE)
+    {
+        return RC_ERROR_BUSY;
+    }
+
+    ch->tdUsed = 0;
+    ch->chainReady = FALSE;
+    ch->pingPong = FALSE;
+    ch->readyBuffer = -1;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Appends one transfer to the chain of a channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param src Source address (lower 16 bit are used).
+ * @param dst Destination address (lower 16 bit are used).
+ * @param length Number of bytes, valid range 1...DMA_MAX_TRANSFER_BYTES.
+ * @param flags Combination of TD_INC_SRC_ADR, TD_INC_DST_ADR, TD_TERMOUT0_EN, ...
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY or RC_ERROR_BUFFER_FULL
+ *         if all reserved TDs are already in use.
+ */
+RC_t DMA_ChainAdd(DMA_handle_t handle, const volatile void* src, volatile void* dst, uint16_t length, uint8_t flags)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if ((ch == NULL) || (length == 0) || (length > DMA_MAX_TRANSFER_BYTES))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    if (ch->running == TRUE)
+    {
+        return RC_ERROR_BUSY;
+    }
+
+    if (ch->tdUsed >= ch->tdCount)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+
+    uint8_t index = ch->tdUsed;
+
+    /* The next TD is linked when the following TD is added or the chain is finished */
+    ch->tdConfig[index] = flags;
+    ch->tdLength[index] = length;
+    CyDmaTdSetConfiguration(ch->td[index], length, CY_DMA_DISABLE_TD, flags);
+    CyDmaTdSetAddress(ch->td[index], LO16((uint32)src), LO16((uint32)dst));
+
+    /* Link the previous TD to this one */
+    if (index > 0)
+    {
+        CyDmaTdSetConfiguration(ch->td[index - 1], ch->tdLength[index - 1], ch->td[index], ch->tdConfig[index - 1]);
+    }
+
+    ch->tdUsed++;
+    ch->chainReady = FALSE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Closes the chain of a channel and programs the start TD.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param mode DMA_CHAIN_SINGLE or DMA_CHAIN_CIRCULAR.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY if the channel is running
+ *         or RC_ERROR_BUFFER_EMTPY if no TD was added.
+ */
+RC_t DMA_ChainFinish(DMA_handle_t handle, DMA_chainMode_t mode)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    /* The start TD must not be changed under a running channel */
+    if (ch->running == TRUE)
+    {
+        return RC_ERROR_BUSY;
+    }
+
+    if (ch->tdUsed == 0)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+
+    uint8_t last = ch->tdUsed - 1;
+    uint8_t next = (mode == DMA_CHAIN_CIRCULAR) ? ch->td[0] : CY_DMA_DISABLE_TD;
+
+    CyDmaTdSetConfiguration(ch->td[last], ch->tdLength[last], next, ch->tdConfig[last]);
+    CyDmaChSetInitialTd(ch->channel, ch->td[0]);
+
+    ch->mode = mode;
+    ch->chainReady = TRUE;
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Builds a circular two TD chain filling two buffers alternately.
+ *
+ * @param handle Handle returned by DMA_Open(), needs at least 2 reserved TDs.
+ * @param src Source (usually a peripheral register).
+ * @param ping First buffer.
+ * @param pong Second buffer.
+ * @param length Size of each buffer in bytes, valid range 1...DMA_MAX_TRANSFER_BYTES.
+ * @param flags TD flags, TD_TERMOUT0_EN is added automatically.
+ * @return RC_SUCCESS or the error of DMA_ChainAdd() / DMA_ChainFinish().
+ */
+RC_t DMA_PingPong(DMA_handle_t handle, const volatile void* src, volatile void* ping, volatile void* pong,
+                  uint16_t length, uint8_t flags)
+{
+    RC_t rc = DMA_ChainReset(handle);
+
+    /* Both halves signal completion, so the consumer can process one while the other is filled */
+    if (rc == RC_SUCCESS)
+    {
+        rc = DMA_ChainAdd(handle, src, ping, length, flags | TD_TERMOUT0_EN);
+    }
+    if (rc == RC_SUCCESS)
+    {
+        rc = DMA_ChainAdd(handle, src, pong, length, flags | TD_TERMOUT0_EN);
+    }
+    if (rc == RC_SUCCESS)
+    {
+        rc = DMA_ChainFinish(handle, DMA_CHAIN_CIRCULAR);
+    }
+    if (rc == RC_SUCCESS)
+    {
+        DMA__channels[handle].pingPong = TRUE;
+    }
+
+    return rc;
+}
+
+/**
+ * @brief Requests an event for a task whenever the channel signals completion.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param task Task receiving the event, must be an extended task.
+ * @param event Event mask to set, 0 disables the notification.
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_SetCompletionEvent(DMA_handle_t handle, TaskType task, EventMaskType event)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    ch->task = task;
+    ch->event = event;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Enables the channel, the chain must have been finished before.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_INVALID_STATE if no chain is ready.
+ */
+RC_t DMA_Start(DMA_handle_t handle)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    if (ch->chainReady == FALSE)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+
+    ch->readyBuffer = -1;
+    ch->running = TRUE;
+
+    /* Keep the TDs, they are reused on every restart */
+    CyDmaChEnable(ch->channel, 1);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Disables the channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_Stop(DMA_handle_t handle)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    CyDmaChDisable(ch->channel);
+    ch->running = FALSE;
+
+    /* Rewind to the start of the chain for the next DMA_Start() */
+    if (ch->chainReady == TRUE)
+    {
+        CyDmaChSetInitialTd(ch->channel, ch->td[0]);
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Completion handler, to be called from the ISR2 connected to the channel's nrq.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_NotifyComplete(DMA_handle_t handle)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if (ch == NULL)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    if (ch->pingPong == TRUE)
+    {
+        /* Halves complete strictly alternating, starting with ping */
+        ch->readyBuffer = (ch->readyBuffer == DMA_BUFFER_PING) ? DMA_BUFFER_PONG : DMA_BUFFER_PING;
+    }
+    else
+    {
+        ch->readyBuffer = DMA_BUFFER_PING;
+
+        /* Only a single chain disables itself after the last TD, a circular one keeps running */
+        if (ch->mode == DMA_CHAIN_SINGLE)
+        {
+            ch->running = FALSE;
+        }
+    }
+
+    if (ch->event != 0)
+    {
+        SetEvent(ch->task, ch->event);
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the buffer of a ping-pong transfer which was filled last.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param buffer Pointer receiving DMA_BUFFER_PING or DMA_BUFFER_PONG.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_BUFFER_EMTPY if nothing completed yet.
+ */
+RC_t DMA_GetReadyBuffer(DMA_handle_t handle, DMA_buffer_t* buffer)
+{
+    DMA__channel_t* ch = DMA__get(handle);
+    if ((ch == NULL) || (buffer == NULL))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    sint8_t ready = ch->readyBuffer;
+    if (ready < 0)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+
+    *buffer = (DMA_buffer_t)ready;
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Resolves a handle to its channel data.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return Pointer to the channel or NULL for an invalid / closed handle.
+ */
+static DMA__channel_t* DMA__get(DMA_handle_t handle)
+{
+    if ((handle >= DMA_MAX_CHANNELS) || (DMA__channels[handle].inUse == FALSE))
+    {
+        return NULL;
+    }
+
+    return &DMA__channels[handle];
+}
@@ -0,0 +1,258 @@
+/**
+* \file dma.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief DMA service layer on top of CyDmac
+*
+* Wraps the raw channel / TD handling of CyDmac.c into per-channel TD pools,
+* a chain builder for single, circular and ping-pong transfers and an optional
+* completion event which is forwarded to an ErikaOS task.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef DMA_H
+#define DMA_H
+
+#include "global.h"
+#include "ErikaOS_ee.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define DMA_MAX_CHANNELS            4       /**< Number of channels managed by the service layer */
+#define DMA_MAX_TD_PER_CHANNEL      8       /**< Maximum TDs reserved for a single channel */
+#define DMA_MAX_TRANSFER_BYTES      4095    /**< Maximum byte count of a single TD */
+
+#define DMA_INVALID_HANDLE          0xFF    /**< Returned when no channel slot is available */
+
+//####################### Enumerations
+
+/**
+ * @brief Termination of a TD chain.
+ */
+typedef enum {
+    DMA_CHAIN_SINGLE,       /**< Chain runs once and the channel stops after the last TD */
+    DMA_CHAIN_CIRCULAR,     /**< Last TD links back to the first one */
+} DMA_chainMode_t;
+
+/**
+ * @brief Halves of a ping-pong transfer.
+ */
+typedef enum {
+    DMA_BUFFER_PING = 0,    /**< First buffer */
+    DMA_BUFFER_PONG = 1,    /**< Second buffer */
+} DMA_buffer_t;
+
+/**
+ * @brief Handle of a channel managed by the service layer, valid range 0...DMA_MAX_CHANNELS-1
+ */
+typedef uint8_t DMA_handle_t;
+
+/**
+ * @brief Static configuration of a channel.
+ */
+typedef struct {
+    uint8_t  channel;           /**< Hardware channel, e.g. returned by <Component>_DmaInitialize() */
+    uint8_t  burstCount;        /**< Bytes per burst, valid range 1...127 */
+    uint8_t  requestPerBurst;   /**< 1: each burst needs a request, 0: whole TD on one request */
+    uint8_t  tdCount;           /**< TDs to reserve for this channel, valid range 1...DMA_MAX_TD_PER_CHANNEL */
+    uint16_t upperSrcAddress;   /**< Upper 16 bit of the source addresses, e.g. HI16(CYDEV_SRAM_BASE) */
+    uint16_t upperDstAddress;   /**< Upper 16 bit of the destination addresses */
+    uint8_t  termout0;          /**< Output line pulsed by TDs with TD_TERMOUT0_EN, <Component>__TERMOUT0_SEL */
+    uint8_t  termout1;          /**< Output line pulsed by TDs with TD_TERMOUT1_EN, <Component>__TERMOUT1_SEL */
+    uint8_t  termin;            /**< Input line ending TDs with TD_TERMIN_EN, <Component>__TERMIN_SEL */
+} DMA_config_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class DMA
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Opens a channel and reserves its TDs from the global TD pool.
+ *
+ * All TDs are taken at open time, so building or rebuilding a chain later on
+ * can never fail because another user has exhausted the global TD list.
+ *
+ * @param config Channel configuration, must not be NULL.
+ * @param handle Pointer receiving the handle of the opened channel.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM for invalid configuration,
+ *         RC_ERROR_MEMORY if no channel slot or not enough TDs are free.
+ */
+RC_t DMA_Open(const DMA_config_t* config, DMA_handle_t* handle);
+
+/**
+ * @brief Stops a channel and returns its TDs to the global TD pool.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM for an unknown handle.
+ */
+RC_t DMA_Close(DMA_handle_t handle);
+
+/**
+ * @brief Discards the chain built so far, the reserved TDs stay with the channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_BUSY if the channel is running.
+ */
+RC_t DMA_ChainReset(DMA_handle_t handle);
+
+/**
+ * @brief Appends one transfer to the chain of a channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param src Source address (lower 16 bit are used).
+ * @param dst Destination address (lower 16 bit are used).
+ * @param length Number of bytes, valid range 1...DMA_MAX_TRANSFER_BYTES.
+ * @param flags Combination of TD_INC_SRC_ADR, TD_INC_DST_ADR, TD_TERMOUT0_EN, ...
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY or RC_ERROR_BUFFER_FULL
+ *         if all reserved TDs are already in use.
+ */
+RC_t DMA_ChainAdd(DMA_handle_t handle, const volatile void* src, volatile void* dst, uint16_t length, uint8_t flags);
+
+/**
+ * @brief Closes the chain of a channel and programs the start TD.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param mode DMA_CHAIN_SINGLE or DMA_CHAIN_CIRCULAR.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY if the channel is running
+ *         or RC_ERROR_BUFFER_EMTPY if no TD was added.
+ */
+RC_t DMA_ChainFinish(DMA_handle_t handle, DMA_chainMode_t mode);
+
+/**
+ * @brief Builds a circular two TD chain filling two buffers alternately.
+ *
+ * Both TDs raise the channel's nrq, so the completion handler is invoked once per half.
+ *
+ * @param handle Handle returned by DMA_Open(), needs at least 2 reserved TDs.
+ * @param src Source (usually a peripheral register).
+ * @param ping First buffer.
+ * @param pong Second buffer.
+ * @param length Size of each buffer in bytes, valid range 1...DMA_MAX_TRANSFER_BYTES.
+ * @param flags TD flags, TD_TERMOUT0_EN is added automatically.
+ * @return RC_SUCCESS or the error of DMA_ChainAdd() / DMA_ChainFinish().
+ */
+RC_t DMA_PingPong(DMA_handle_t handle, const volatile void* src, volatile void* ping, volatile void* pong,
+                  uint16_t length, uint8_t flags);
+
+/**
+ * @brief Requests an event for a task whenever the channel signals completion.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param task Task receiving the event, must be an extended task.
+ * @param event Event mask to set, 0 disables the notification.
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_SetCompletionEvent(DMA_handle_t handle, TaskType task, EventMaskType event);
+
+/**
+ * @brief Enables the channel, the chain must have been finished before.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_INVALID_STATE if no chain is ready.
+ */
+RC_t DMA_Start(DMA_handle_t handle);
+
+/**
+ * @brief Disables the channel.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_Stop(DMA_handle_t handle);
+
+/**
+ * @brief Completion handler, to be called from the ISR2 connected to the channel's nrq.
+ *
+ * Toggles the active half of a ping-pong transfer and forwards the completion
+ * event configured by DMA_SetCompletionEvent().
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @return RC_SUCCESS or RC_ERROR_BAD_PARAM.
+ */
+RC_t DMA_NotifyComplete(DMA_handle_t handle);
+
+/**
+ * @brief Returns the buffer of a ping-pong transfer which was filled last.
+ *
+ * @param handle Handle returned by DMA_Open().
+ * @param buffer Pointer receiving DMA_BUFFER_PING or DMA_BUFFER_PONG.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM or RC_ERROR_BUFFER_EMTPY if nothing completed yet.
+ */
+RC_t DMA_GetReadyBuffer(DMA_handle_t handle, DMA_buffer_t* buffer);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* DMA_H */
@@ -0,0 +1,160 @@
+/**
+* \file fmt.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Bounded, allocation free decimal formatting
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "fmt.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/** value / 100 for the full uint32_t range, 0x51EB851F = ceil(2^37 / 100) */
+#define FMT__DIV100(value)  ((uint32_t)(((uint64_t)(value) * 0x51EB851Fu) >> 37))
+
+#define FMT__MAX_DIGITS     10      /**< Digits of 0xFFFFFFFF */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/** "00", "01", ... "99" back to back, pair n starts at index 2 * n */
+static const char_t FMT__pairs[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static uint8_t FMT__digits(uint32_t value);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Writes a number in decimal, e.g. 1234 -> "1234".
+ *
+ * @param value Number, full range.
+ * @param buffer Buffer receiving the terminated string.
+ * @param size Size of buffer, FMT_U32_SIZE (FMT_U16_SIZE, FMT_U8_SIZE) always suffices.
+ * @param length Pointer receiving the string length without terminator, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_FULL if size is too
+ *         small (buffer then holds an empty string if size > 0).
+ */
+RC_t FMT_U32(uint32_t value, char_t* buffer, uint8_t size, uint8_t* length)
+{
+    return FMT_U32Width(value, 0, ' ', buffer, size, length);
+}
+
+/**
+ * @brief Writes a number in decimal, right aligned to a minimum width,
+ *        e.g. 42, width 5, pad '0' -> "00042". Longer numbers are not cut.
+ *
+ * @param value Number, full range.
+ * @param width Minimum number of characters, valid range 0...size-1.
+ * @param pad Fill character, e.g. '0' or ' '.
+ * @param buffer Buffer receiving the terminated string.
+ * @param size Size of buffer.
+ * @param length Pointer receiving the string length without terminator, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_FULL if size is too
+ *         small (buffer then holds an empty string if size > 0).
+ */
+RC_t FMT_U32Width(uint32_t value, uint8_t width, char_t pad, char_t* buffer, uint8_t size, uint8_t* length)
+{
+    if (buffer == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    uint8_t digits = FMT__digits(value);
+    uint8_t total = (width > digits) ? width : digits;
+    
+    if (total >= size)
+    {
+        if (size > 0)
+        {
+            buffer[0] = '\0';
+        }
+        return RC_ERROR_BUFFER_FULL;
+    }
+    
+    uint8_t pos = total;
+    
+    buffer[pos] = '\0';
+    
+    /* Two digits per division */
+    while (value >= 100)
+    {
+        uint32_t quotient = FMT__DIV100(value);
+        const char_t* pair = &FMT__pairs[2 * (value - quotient * 100)];
+        
+        buffer[--pos] = pair[1];
+        buffer[--pos] = pair[0];
+        value = quotient;
+    }
+    
+    /* Leading one or two digits */
+    if (value >= 10)
+    {
+        buffer[--pos] = FMT__pairs[2 * value + 1];
+        buffer[--pos] = FMT__pairs[2 * value];
+    }
+    else
+    {
+        buffer[--pos] = (char_t)('0' + value);
+    }
+    
+    while (pos > 0)
+    {
+        buffer[--pos] = pad;
+    }
+    
+    if (length != NULL)
+    {
+        *length = total;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Number of decimal digits.
+ *
+ * @param value Number, full range.
+ * @return 1...FMT__MAX_DIGITS.
+ */
+static uint8_t FMT__digits(uint32_t value)
+{
+    uint8_t digits = 1;
+    uint32_t limit = 10;
+    
+    /* 10^9 is the last power of ten below 2^32 */
+    while ((digits < FMT__MAX_DIGITS) && (value >= limit))
+    {
+        ++digits;
+        limit *= 10;
+    }
+
+    return digits;
+}
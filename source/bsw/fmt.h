@@ -0,0 +1,134 @@
+/**
+* \file fmt.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Bounded, allocation free decimal formatting
+*
+* Numbers are written right to left, two digits per step from a digit pair
+* table, dividing by 100 with a multiply and shift instead of a division
+* instruction. The number of digits is known upfront, so nothing needs to
+* be reversed afterwards. Every function takes the size of the caller's
+* buffer, never writes past it and returns the string length.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef FMT_H
+#define FMT_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define FMT_U8_SIZE     4       /**< Buffer size for any uint8_t including the terminator */
+#define FMT_U16_SIZE    6       /**< Buffer size for any uint16_t including the terminator */
+#define FMT_U32_SIZE    11      /**< Buffer size for any uint32_t including the terminator */
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class FMT
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Writes a number in decimal, e.g. 1234 -> "1234".
+ *
+ * @param value Number, full range.
+ * @param buffer Buffer receiving the terminated string.
+ * @param size Size of buffer, FMT_U32_SIZE (FMT_U16_SIZE, FMT_U8_SIZE) always suffices.
+ * @param length Pointer receiving the string length without terminator, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_FULL if size is too
+ *         small (buffer then holds an empty string if size > 0).
+ */
+RC_t FMT_U32(uint32_t value, char_t* buffer, uint8_t size, uint8_t* length);
+
+/**
+ * @brief Writes a number in decimal, right aligned to a minimum width,
+ *        e.g. 42, width 5, pad '0' -> "00042". Longer numbers are not cut.
+ *
+ * @param value Number, full range.
+ * @param width Minimum number of characters, valid range 0...size-1.
+ * @param pad Fill character, e.g. '0' or ' '.
+ * @param buffer Buffer receiving the terminated string.
+ * @param size Size of buffer.
+ * @param length Pointer receiving the string length without terminator, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_FULL if size is too
+ *         small (buffer then holds an empty string if size > 0).
+ */
+RC_t FMT_U32Width(uint32_t value, uint8_t width, char_t pad, char_t* buffer, uint8_t size, uint8_t* length);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* FMT_H */
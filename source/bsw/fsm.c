@@ -0,0 +1,231 @@
+/**
+* \file fsm.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Table driven finite state machine engine
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "fsm.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define FSM__COUNT_MAX      0xFFFFu     /**< Saturation of the coverage counters */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Initialises a state machine.
+ *
+ * @param fsm Instance to initialise.
+ * @param table states x events actions, row major (e.g. &table[0][0]).
+ * @param states Number of states, valid range 1...255.
+ * @param events Number of events, valid range 1...255.
+ * @param initial Initial state, valid range 0...states-1.
+ * @param context Passed to every action, may be NULL.
+ * @param coverage states x events counters cleared here, NULL disables coverage.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_ZERO, RC_ERROR_BAD_PARAM.
+ */
+RC_t FSM_Init(FSM_t* fsm, const FSM_action_t* table, uint8_t states, uint8_t events,
+              FSM_state_t initial, void* context, uint16_t* coverage)
+{
+    if ((fsm == NULL) || (table == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if ((states == 0) || (events == 0))
+    {
+        return RC_ERROR_ZERO;
+    }
+    
+    if (initial >= states)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    fsm->table = table;
+    fsm->coverage = coverage;
+    fsm->context = context;
+    fsm->states = states;
+    fsm->events = events;
+    fsm->state = initial;
+    
+    if (coverage != NULL)
+    {
+        for (uint16_t i = 0; i < (uint16_t)states * events; ++i)
+        {
+            coverage[i] = 0;
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Runs the transition of an event in the current state.
+ *
+ * @param fsm Initialised instance.
+ * @param event Event to dispatch, valid range 0...events-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_INVALID_STATE if the event is ignored in the current state
+ *         or the action returned an invalid state (the state is kept).
+ */
+RC_t FSM_Dispatch(FSM_t* fsm, FSM_event_t event)
+{
+    if (fsm == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (event >= fsm->events)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    uint16_t cell = (uint16_t)fsm->state * fsm->events + event;
+    
+    if ((fsm->coverage != NULL) && (fsm->coverage[cell] < FSM__COUNT_MAX))
+    {
+        ++fsm->coverage[cell];
+    }
+    
+    FSM_action_t action = fsm->table[cell];
+    
+    if (action == FSM_IGNORE)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    FSM_state_t next = action(fsm->state, fsm->context);
+    
+    if (next >= fsm->states)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    fsm->state = next;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the current state.
+ *
+ * @param fsm Initialised instance.
+ * @param state Pointer receiving the state.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t FSM_GetState(const FSM_t* fsm, FSM_state_t* state)
+{
+    if ((fsm == NULL) || (state == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    *state = fsm->state;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the transition coverage of the table.
+ *
+ * @param fsm Initialised instance with coverage counters.
+ * @param defined Pointer receiving the number of cells with an action.
+ * @param hit Pointer receiving the number of cells with an action dispatched at least once.
+ * @param ignored Pointer receiving the number of dispatches of FSM_IGNORE cells.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_INVALID_STATE without coverage counters.
+ */
+RC_t FSM_GetCoverage(const FSM_t* fsm, uint16_t* defined, uint16_t* hit, uint32_t* ignored)
+{
+    if ((fsm == NULL) || (defined == NULL) || (hit == NULL) || (ignored == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (fsm->coverage == NULL)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    *defined = 0;
+    *hit = 0;
+    *ignored = 0;
+    
+    for (uint16_t i = 0; i < (uint16_t)fsm->states * fsm->events; ++i)
+    {
+        if (fsm->table[i] == FSM_IGNORE)
+        {
+            *ignored += fsm->coverage[i];
+        }
+        else
+        {
+            ++*defined;
+            
+            if (fsm->coverage[i] != 0)
+            {
+                ++*hit;
+            }
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns how often the transition of one table cell was dispatched.
+ *
+ * @param fsm Initialised instance with coverage counters.
+ * @param state State of the cell.
+ * @param event Event of the cell.
+ * @param count Pointer receiving the count, saturates at 65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM, RC_ERROR_INVALID_STATE.
+ */
+RC_t FSM_GetTransitionCount(const FSM_t* fsm, FSM_state_t state, FSM_event_t event, uint16_t* count)
+{
+    if ((fsm == NULL) || (count == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if ((state >= fsm->states) || (event >= fsm->events))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    if (fsm->coverage == NULL)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    *count = fsm->coverage[(uint16_t)state * fsm->events + event];
+
+    return RC_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/**
+* \file fsm.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Table driven finite state machine engine
+*
+* The transitions are a constant states x events table of action function
+* pointers, so dispatching an event is one index calculation and one call,
+* independent of the number of states and events. The action returns the
+* next state, which lets it implement guarded transitions; FSM_IGNORE cells
+* leave the state unchanged. Declare the table with an open first dimension
+* and check it with FSM_ROWS() / FSM_STATIC_ASSERT(), so a missing state row
+* stops the build. Optionally every dispatch is counted per table cell for a
+* transition coverage report.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef FSM_H
+#define FSM_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define FSM_IGNORE      NULL    /**< Table cell: event is ignored in this state */
+
+/** Number of state rows of a table declared as table[][EVENTS] */
+#define FSM_ROWS(table)                 (sizeof(table) / sizeof((table)[0]))
+
+/** Build stops with a negative array size if cond is false */
+#define FSM_STATIC_ASSERT(cond, name)   typedef char FSM__assert_##name[(cond) ? 1 : -1]
+
+//####################### TYPES
+
+typedef uint8_t FSM_state_t;    /**< State index, valid range 0...states-1 */
+typedef uint8_t FSM_event_t;    /**< Event index, valid range 0...events-1 */
+
+/**
+ * @brief Action of a transition.
+ *
+ * @param state Current state.
+ * @param context Context given to FSM_Init().
+ * @return Next state, valid range 0...states-1.
+ */
+typedef FSM_state_t (*FSM_action_t)(FSM_state_t state, void* context);
+
+/**
+ * @brief One state machine instance, initialise with FSM_Init().
+ */
+typedef struct {
+    const FSM_action_t* table;  /**< states x events actions, row major */
+    uint16_t* coverage;         /**< states x events dispatch counters or NULL */
+    void* context;              /**< Passed to every action */
+    uint8_t states;             /**< Number of states */
+    uint8_t events;             /**< Number of events */
+    FSM_state_t state;          /**< Current state */
+} FSM_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class FSM
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Initialises a state machine.
+ *
+ * @param fsm Instance to initialise.
+ * @param table states x events actions, row major (e.g. &table[0][0]).
+ * @param states Number of states, valid range 1...255.
+ * @param events Number of events, valid range 1...255.
+ * @param initial Initial state, valid range 0...states-1.
+ * @param context Passed to every action, may be NULL.
+ * @param coverage states x events counters cleared here, NULL disables coverage.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_ZERO, RC_ERROR_BAD_PARAM.
+ */
+RC_t FSM_Init(FSM_t* fsm, const FSM_action_t* table, uint8_t states, uint8_t events,
+              FSM_state_t initial, void* context, uint16_t* coverage);
+
+/**
+ * @brief Runs the transition of an event in the current state.
+ *
+ * @param fsm Initialised instance.
+ * @param event Event to dispatch, valid range 0...events-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_INVALID_STATE if the event is ignored in the current state
+ *         or the action returned an invalid state (the state is kept).
+ */
+RC_t FSM_Dispatch(FSM_t* fsm, FSM_event_t event);
+
+/**
+ * @brief Returns the current state.
+ *
+ * @param fsm Initialised instance.
+ * @param state Pointer receiving the state.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t FSM_GetState(const FSM_t* fsm, FSM_state_t* state);
+
+/**
+ * @brief Returns the transition coverage of the table.
+ *
+ * @param fsm Initialised instance with coverage counters.
+ * @param defined Pointer receiving the number of cells with an action.
+ * @param hit Pointer receiving the number of cells with an action dispatched at least once.
+ * @param ignored Pointer receiving the number of dispatches of FSM_IGNORE cells.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_INVALID_STATE without coverage counters.
+ */
+RC_t FSM_GetCoverage(const FSM_t* fsm, uint16_t* defined, uint16_t* hit, uint32_t* ignored);
+
+/**
+ * @brief Returns how often the transition of one table cell was dispatched.
+ *
+ * @param fsm Initialised instance with coverage counters.
+ * @param state State of the cell.
+ * @param event Event of the cell.
+ * @param count Pointer receiving the count, saturates at 65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM, RC_ERROR_INVALID_STATE.
+ */
+RC_t FSM_GetTransitionCount(const FSM_t* fsm, FSM_state_t state, FSM_event_t event, uint16_t* count);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* FSM_H */
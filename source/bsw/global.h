@@ -8,6 +8,12 @@
  * \brief Global definitions for datatypes and definitions
  *
  *	Changelog:\n
+ *  - 1.2 18.10.26 Sadique
+ *  	- #DELAY_MS and #DELAY_US map to the OS aware delays of delay.h with ERIKA OS
+ *  	- delay.h is included at the end of the file, it needs the types of this file
+ *  - 1.1 18.10.26 Sadique
+ *  	- #OS can be selected on the command line, host builds use OS_NONE
+ *  	- 32 bit types stay 32 bit on LP64 hosts, for the module tests in test/
  *  - 1.0 06.07.18 Barth
  *  	- BaseSys V3
  *  	- INLINE had static keyword. Split into INLINE and STATIC_INLINE
@@ -59,7 +65,9 @@
 #define OS_FREERTOS     2                           /**< \brief target runs FreeRTOS*/
 #define OS_ERIKA        3                           /**< \brief target runs ERIKA OS*/
         
-#define OS              OS_ERIKA                    /**< \brief OS selection*/
+#ifndef OS
+    #define OS          OS_ERIKA                    /**< \brief OS selection, host builds pass -DOS=OS_NONE*/
+#endif
     
 //-------------------------------------------------------------------- [Target specific includes]
 #if(ARCHITECTURE==ARCH_AURIX_1G)
@@ -108,6 +116,9 @@
         vTaskDelay(ms*portTICK_PERIOD_MS); 
         
         #define DELAY_US(us)    CyDelayUs(us)       				/**< \brief microseconds Delay Macro for the use with FreeRTOS. Uses blocking Cypress implementation*/
+    #elif(OS==OS_ERIKA)
+        #define DELAY_MS(ms)    DELAY_Ms(ms)        				/**< \brief milliseconds Delay Macro for the use with ERIKA OS. Suspends the calling extended task, see delay.h*/
+        #define DELAY_US(us)    DELAY_Us(us)        				/**< \brief microseconds Delay Macro for the use with ERIKA OS. Spins on the time base, see delay.h*/
     #else
         #define DELAY_MS(ms)    CyDelay(ms)         				/**< \brief milliseconds Delay Macro for the use with baremetal PSoC*/
         #define DELAY_US(us)    CyDelayUs(us)       				/**< \brief microseconds Delay Macro for the use with baremetal PSoC*/
@@ -145,14 +156,26 @@ typedef signed 		char    	sint8_t;            /**< \brief         -128 .. +127
 typedef unsigned 	char  		uint8_t;            /**< \brief            0 .. 255             */
 typedef signed 		short   	sint16_t;           /**< \brief       -32768 .. +32767          */
 typedef unsigned 	short 		uint16_t;           /**< \brief            0 .. 65535           */
+/* On LP64 hosts, e.g. for the module tests in test/, long is 64 bit */
+#if (__SIZEOF_LONG__ == 8)
+typedef signed 		int    		sint32_t;           /**< \brief  -2147483648 .. +2147483647     */
+#ifndef uint32_t
+    typedef unsigned 	int  		uint32_t;           /**< \brief            0 .. 4294967295      */
+#endif
+#else
 typedef signed 		long    	sint32_t;           /**< \brief  -2147483648 .. +2147483647     */
 #ifndef uint32_t
     typedef unsigned 	long  		uint32_t;           /**< \brief            0 .. 4294967295      */
 #endif
+#endif
 typedef 			float   	float32_t;	        /**< \brief  single precision floating point number (4 byte) */
 typedef 			double  	float64_t;	        /**< \brief  double precision floating point number (8 byte) */
 typedef signed 		long long   sint64_t;           /**< \brief -9223372036854775808 .. +9223372036854775807     */
+#if (__SIZEOF_LONG__ == 8)
+typedef unsigned 	long  		uint64_t;           /**< \brief                    0 .. 18446744073709551615     */
+#else
 typedef unsigned 	long long 	uint64_t;           /**< \brief                    0 .. 18446744073709551615     */
+#endif
 typedef unsigned	char  		boolean_t; 	        /**< \brief  for use with TRUE/FALSE        */
 typedef 			char    	char_t;		        /**< \brief	Character Datatype*/
 
@@ -344,5 +367,10 @@ typedef enum{
 /** \brief Absolute Jump */
 #define __absolute_jump(adr)	__asm__ volatile ("ja "#adr)
 
+//-------------------------------------------------------------------- [Delay functions]
+#if((ARCHITECTURE==ARCH_PSOC) && (OS==OS_ERIKA))
+	#include "delay.h"													/* Functions behind #DELAY_MS and #DELAY_US */
+#endif
+
 
 #endif /* GLOBAL_H_ */
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+* \file hrtimer.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Hardware timer of the high resolution kernel counter cnt_hires
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "hrtimer.h"
+
+#ifdef EE_HR_COUNTER__
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts Counter_HiRes with the compare interrupt enabled.
+ *
+ * The counter runs up from 0 and wraps at EE_HR_COUNTER_MAXALLOWEDVALUE, the
+ * compare is left at its reset value until the first alarm is set.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t HRTIMER_Init(void)
+{
+    Counter_HiRes_Start();
+    Counter_HiRes_WritePeriod(EE_HR_COUNTER_MAXALLOWEDVALUE);
+    Counter_HiRes_SetInterruptMode(Counter_HiRes_STATUS_CMP_INT_EN_MASK);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Clears the compare interrupt, first statement of isr_hires.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t HRTIMER_Acknowledge(void)
+{
+    (void)Counter_HiRes_ReadStatusRegister();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Kernel hook: current value of the free running timer.
+ *
+ * @return Counter_HiRes count, 0...EE_HR_COUNTER_MAXALLOWEDVALUE
+ */
+TickType EE_hr_timer_read(void)
+{
+    return (TickType)Counter_HiRes_ReadCounter();
+}
+
+/**
+ * @brief Kernel hook: programs the next compare match.
+ *
+ * @param Value Count at which isr_hires fires, 0...EE_HR_COUNTER_MAXALLOWEDVALUE
+ */
+void EE_hr_timer_set_compare(TickType Value)
+{
+    Counter_HiRes_WriteCompare((uint32)Value);
+}
+
+/**
+ * @brief Kernel hook: raises isr_hires for an expiry the timer has already passed.
+ */
+void EE_hr_timer_trigger(void)
+{
+    CyIntSetPending(isr_hires__INTC_NUMBER);
+}
+
+#endif /* EE_HR_COUNTER__ */
@@ -0,0 +1,315 @@
+/**
+* \file latency.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Interrupt entry latency and jitter measurement
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "latency.h"
+#include "cycle.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Histogram and pending trigger of one probe.
+ *
+ * Written by the ISR of the probe only, read by LATENCY_GetStats().
+ */
+typedef struct {
+    volatile boolean_t pending;             /**< LATENCY_Trigger() waits for the ISR */
+    volatile uint32_t  triggerCycle;        /**< Cycle counter at the trigger */
+    uint32_t samples;                       /**< Number of samples */
+    uint32_t min;                           /**< Best case latency */
+    uint32_t max;                           /**< Worst case latency */
+    uint32_t histogram[LATENCY_BUCKETS];    /**< Samples per bucket */
+} LATENCY__probe_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+static LATENCY__probe_t LATENCY__probes[LATENCY_PROBES];
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void LATENCY__record(LATENCY__probe_t* p, uint32_t cycles);
+static uint32_t LATENCY__percentile(const uint32_t* histogram, uint32_t samples, uint8_t percent);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and clears all histograms.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_Init(void)
+{
+    CYCLE_Init();
+    
+    return LATENCY_Reset();
+}
+
+/**
+ * @brief Stamps the cycle counter and pends the interrupt of a probe.
+ *
+ * @param probe Probe measured by the ISR of irqNumber.
+ * @param irqNumber NVIC number of the interrupt (e.g. isr_timer__INTC_NUMBER).
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY if the previous
+ *         trigger of this probe has not been served yet.
+ */
+RC_t LATENCY_Trigger(LATENCY_probe_t probe, uint8_t irqNumber)
+{
+    if ((probe != LATENCY_BUTTONS) && (probe != LATENCY_TIMER))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    LATENCY__probe_t* p = &LATENCY__probes[probe];
+    
+    if (p->pending == TRUE)
+    {
+        return RC_ERROR_BUSY;
+    }
+    
+    /* Stamp before arming, a real press may enter the ISR in between */
+    p->triggerCycle = CYCLE_NOW();
+    p->pending = TRUE;
+    CyIntSetPending(irqNumber);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Stamps the cycle counter for a probe measured in software only.
+ *
+ * Used for the dispatch probes: the end of an ISR body marks, LATENCY_Entry()
+ * in the code that runs next takes the difference.
+ *
+ * @param probe LATENCY_DISPATCH, LATENCY_RETURN or LATENCY_SIGNAL.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM for an interrupt probe.
+ */
+RC_t LATENCY_Mark(LATENCY_probe_t probe)
+{
+    if ((probe < LATENCY_DISPATCH) || (probe >= LATENCY_PROBES))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    LATENCY__probe_t* p = &LATENCY__probes[probe];
+    
+    p->triggerCycle = CYCLE_NOW();
+    p->pending = TRUE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Records the entry latency of a software pended ISR.
+ *
+ * Must be the first statement of the ISR body (of the task for the
+ * dispatch probes).
+ *
+ * @param probe Probe of the ISR.
+ * @return RC_SUCCESS if the entry was caused by LATENCY_Trigger() or LATENCY_Mark(),
+ *         RC_ERROR_INVALID_STATE for a real interrupt (nothing recorded),
+ *         RC_ERROR_BAD_PARAM.
+ */
+RC_t LATENCY_Entry(LATENCY_probe_t probe)
+{
+    uint32_t now = CYCLE_NOW();
+    
+    if (probe >= LATENCY_PROBES)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    LATENCY__probe_t* p = &LATENCY__probes[probe];
+    
+    if (p->pending == FALSE)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    LATENCY__record(p, now - p->triggerCycle);
+    p->pending = FALSE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Records the entry latency of the SysTick handler.
+ *
+ * Must be the first statement of systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_EntrySysTick(void)
+{
+    /* SysTick counts down from RELOAD at CPU clock, the interrupt was raised
+     * when it reloaded */
+    uint32_t cycles = CY_GET_REG32(CYREG_NVIC_SYSTICK_RELOAD) - CY_GET_REG32(CYREG_NVIC_SYSTICK_CURRENT);
+    
+    LATENCY__record(&LATENCY__probes[LATENCY_SYSTICK], cycles);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Computes the summary of one probe.
+ *
+ * @param probe Probe to evaluate.
+ * @param stats Pointer receiving the summary.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY if the probe has no samples.
+ */
+RC_t LATENCY_GetStats(LATENCY_probe_t probe, LATENCY_stats_t* stats)
+{
+    if (stats == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (probe >= LATENCY_PROBES)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    /* Consistent snapshot, the ISR of the probe may record at any time. PRIMASK,
+     * the kernel lock does not mask isr_buttons with EE_CORTEX_MX_KERNEL_BASEPRI */
+    static uint32_t histogram[LATENCY_BUCKETS];
+    LATENCY__probe_t* p = &LATENCY__probes[probe];
+    
+    uint8 state = CyEnterCriticalSection();
+    stats->samples = p->samples;
+    stats->min = p->min;
+    stats->max = p->max;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; ++i)
+    {
+        histogram[i] = p->histogram[i];
+    }
+    CyExitCriticalSection(state);
+    
+    if (stats->samples == 0)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+    
+    stats->p50 = LATENCY__percentile(histogram, stats->samples, 50);
+    stats->p99 = LATENCY__percentile(histogram, stats->samples, 99);
+    
+    /* The last bucket is open ended */
+    if (stats->p50 > stats->max)
+    {
+        stats->p50 = stats->max;
+    }
+    if (stats->p99 > stats->max)
+    {
+        stats->p99 = stats->max;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Clears the histograms of all probes, e.g. after a priority change.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_Reset(void)
+{
+    /* PRIMASK, isr_buttons records into its probe above the kernel lock */
+    uint8 state = CyEnterCriticalSection();
+    for (uint8_t i = 0; i < LATENCY_PROBES; ++i)
+    {
+        LATENCY__probe_t* p = &LATENCY__probes[i];
+        
+        p->pending = FALSE;
+        p->samples = 0;
+        p->min = uint32_t_MAX;
+        p->max = 0;
+        for (uint8_t j = 0; j < LATENCY_BUCKETS; ++j)
+        {
+            p->histogram[j] = 0;
+        }
+    }
+    CyExitCriticalSection(state);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Adds one sample to a probe.
+ *
+ * @param p Probe to update.
+ * @param cycles Measured latency.
+ */
+static void LATENCY__record(LATENCY__probe_t* p, uint32_t cycles)
+{
+    uint32_t bucket = cycles / LATENCY_BUCKET_CYCLES;
+    
+    if (bucket >= LATENCY_BUCKETS)
+    {
+        bucket = LATENCY_BUCKETS - 1;
+    }
+    
+    ++p->histogram[bucket];
+    ++p->samples;
+    
+    if (cycles < p->min)
+    {
+        p->min = cycles;
+    }
+    if (cycles > p->max)
+    {
+        p->max = cycles;
+    }
+}
+
+/**
+ * @brief Upper bound of the bucket containing the given percentile.
+ *
+ * @param histogram Samples per bucket.
+ * @param samples Total number of samples, > 0.
+ * @param percent Percentile 1..100.
+ * @return Latency in cycles.
+ */
+static uint32_t LATENCY__percentile(const uint32_t* histogram, uint32_t samples, uint8_t percent)
+{
+    /* Rank of the sample, rounded up */
+    uint32_t rank = (uint32_t)(((uint64_t)samples * percent + 99) / 100);
+    uint32_t seen = 0;
+    uint8_t i;
+    
+    for (i = 0; i < LATENCY_BUCKETS - 1; ++i)
+    {
+        seen += histogram[i];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    return ((uint32_t)i + 1) * LATENCY_BUCKET_CYCLES - 1;
+}
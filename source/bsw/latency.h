@@ -0,0 +1,212 @@
+/**
+* \file latency.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Interrupt entry latency and jitter measurement
+*
+* Entry latency is the time from the moment an interrupt is raised until the
+* first instruction of the ISR body, in CPU cycles (DWT, see cycle.h):
+* - software pended ISRs: LATENCY_Trigger() stamps the cycle counter and pends
+*   the IRQ, LATENCY_Entry() at the top of the ISR body takes the difference
+* - systick_handler: the SysTick reload is the trigger, LATENCY_EntrySysTick()
+*   reads how far the SysTick counter has already counted down
+* The dispatch probes measure the way back out of an ISR2 through the kernel:
+* LATENCY_Mark() at the end of the ISR body, LATENCY_Entry() in the task that
+* runs next, either a preempting one or the interrupted one. The signal probe
+* starts at the entry of an ISR2 instead and ends in an extended task woken up
+* by an event of the ISR, the way a button press or timeout reaches the game.
+* Every sample goes into a per ISR histogram from which p50/p99/max are taken.
+*/
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define LATENCY_BENCHMARK       OFF     /**< ON: ISRs are instrumented and tsk_background pends them */
+#define LATENCY_SIGNAL_FROM_ISR ON      /**< Event of the signal probe, ON: SetEventFromISR(), OFF: SetEvent() */
+
+#define LATENCY_BUCKET_CYCLES   16      /**< Width of one histogram bucket [cycles] */
+#define LATENCY_BUCKETS         64      /**< Number of buckets, the last one collects everything above */
+
+//####################### ENUMERATIONS
+
+/**
+ * @brief Measured interrupt sources.
+ */
+typedef enum {
+    LATENCY_SYSTICK,    /**< systick_handler, triggered by the SysTick reload */
+    LATENCY_BUTTONS,    /**< isr_buttons, software pended */
+    LATENCY_TIMER,      /**< isr_timer, software pended */
+    LATENCY_DISPATCH,   /**< End of systick_handler until tsk_fader, activated by its alarm, starts */
+    LATENCY_RETURN,     /**< End of isr_timer until the interrupted tsk_background continues */
+    LATENCY_SIGNAL,     /**< Entry of isr_timer until tsk_reactionGame, woken up by its event, resumes */
+    LATENCY_PROBES      /**< Number of probes */
+} LATENCY_probe_t;
+
+//####################### STRUCTURES
+
+/**
+ * @brief Summary of one probe, all values in CPU cycles.
+ *
+ * p50 and p99 are the upper bound of the histogram bucket the percentile
+ * falls into, min and max are exact.
+ */
+typedef struct {
+    uint32_t samples;   /**< Number of samples */
+    uint32_t min;       /**< Best case latency */
+    uint32_t p50;       /**< Median latency */
+    uint32_t p99;       /**< 99th percentile latency */
+    uint32_t max;       /**< Worst case latency */
+} LATENCY_stats_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class LATENCY
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and clears all histograms.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_Init(void);
+
+/**
+ * @brief Stamps the cycle counter and pends the interrupt of a probe.
+ *
+ * @param probe Probe measured by the ISR of irqNumber.
+ * @param irqNumber NVIC number of the interrupt (e.g. isr_timer__INTC_NUMBER).
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM, RC_ERROR_BUSY if the previous
+ *         trigger of this probe has not been served yet.
+ */
+RC_t LATENCY_Trigger(LATENCY_probe_t probe, uint8_t irqNumber);
+
+/**
+ * @brief Stamps the cycle counter for a probe measured in software only.
+ *
+ * Used for the dispatch probes: the end of an ISR body marks, LATENCY_Entry()
+ * in the code that runs next takes the difference.
+ *
+ * @param probe LATENCY_DISPATCH, LATENCY_RETURN or LATENCY_SIGNAL.
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM for an interrupt probe.
+ */
+RC_t LATENCY_Mark(LATENCY_probe_t probe);
+
+/**
+ * @brief Records the entry latency of a software pended ISR.
+ *
+ * Must be the first statement of the ISR body (of the task for the
+ * dispatch probes).
+ *
+ * @param probe Probe of the ISR.
+ * @return RC_SUCCESS if the entry was caused by LATENCY_Trigger() or LATENCY_Mark(),
+ *         RC_ERROR_INVALID_STATE for a real interrupt (nothing recorded),
+ *         RC_ERROR_BAD_PARAM.
+ */
+RC_t LATENCY_Entry(LATENCY_probe_t probe);
+
+/**
+ * @brief Records the entry latency of the SysTick handler.
+ *
+ * Must be the first statement of systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_EntrySysTick(void);
+
+/**
+ * @brief Computes the summary of one probe.
+ *
+ * @param probe Probe to evaluate.
+ * @param stats Pointer receiving the summary.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BAD_PARAM,
+ *         RC_ERROR_BUFFER_EMTPY if the probe has no samples.
+ */
+RC_t LATENCY_GetStats(LATENCY_probe_t probe, LATENCY_stats_t* stats);
+
+/**
+ * @brief Clears the histograms of all probes, e.g. after a priority change.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t LATENCY_Reset(void);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* LATENCY_H */
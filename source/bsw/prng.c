@@ -0,0 +1,271 @@
+/**
+* \file prng.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Small state pseudo random number generator
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "prng.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define PRNG__GOLDEN        0x9E3779B9u     /**< splitmix32 increment */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/** Generator of the game, preset as by PRNG_Init(0) */
+static PRNG_t PRNG__game = {
+    {0x92CA2F0Eu, 0x3CD6E3F3u, 0x1B147DCCu, 0x4C081DBFu},
+    4u * PRNG__GOLDEN
+};
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static void PRNG__seed(PRNG_t* prng, uint32_t seed);
+static RC_t PRNG__range(PRNG_t* prng, uint32_t bound, uint32_t* value);
+static uint32_t PRNG__rotl(uint32_t x, uint8_t k);
+static uint32_t PRNG__mix(uint32_t x);
+static uint32_t PRNG__next(PRNG_t* prng);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Sets the generator state from a seed.
+ *
+ * @param seed Any value, e.g. a timer value.
+ * @return RC_SUCCESS
+ */
+RC_t PRNG_Init(uint32_t seed)
+{
+    PRNG__seed(&PRNG__game, seed);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Stirs an entropy sample into the generator state.
+ *
+ * @param sample Any value.
+ * @return RC_SUCCESS
+ */
+RC_t PRNG_AddEntropy(uint32_t sample)
+{
+    PRNG_t* prng = &PRNG__game;
+    
+    /* Advance the seeding stream by the sample and fold it into every word */
+    prng->stream += PRNG__GOLDEN ^ sample;
+    
+    for (uint8_t i = 0; i < PRNG_STATE_WORDS; ++i)
+    {
+        prng->stream += PRNG__GOLDEN;
+        prng->state[i] ^= PRNG__mix(prng->stream);
+    }
+    
+    /* xor may hit the one forbidden state */
+    if ((prng->state[0] | prng->state[1] | prng->state[2] | prng->state[3]) == 0)
+    {
+        prng->state[0] = PRNG__GOLDEN;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the next 32 bit value.
+ *
+ * @param value Pointer receiving the value, full range.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t PRNG_Next(uint32_t* value)
+{
+    if (value == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    *value = PRNG__next(&PRNG__game);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns an unbiased value in [0, bound).
+ *
+ * @param bound Number of possible values, valid range 1...0xFFFFFFFF.
+ * @param value Pointer receiving the value, range 0...bound-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t PRNG_Range(uint32_t bound, uint32_t* value)
+{
+    return PRNG__range(&PRNG__game, bound, value);
+}
+
+/**
+ * @brief Sets up an own generator instance from a seed.
+ *
+ * @param prng Instance to set up.
+ * @param seed Any value, the same seed gives the same sequence.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t PRNG_Create(PRNG_t* prng, uint32_t seed)
+{
+    if (prng == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    PRNG__seed(prng, seed);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns an unbiased value in [0, bound) from an own generator instance.
+ *
+ * @param prng Instance set up by PRNG_Create().
+ * @param bound Number of possible values, valid range 1...0xFFFFFFFF.
+ * @param value Pointer receiving the value, range 0...bound-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t PRNG_Draw(PRNG_t* prng, uint32_t bound, uint32_t* value)
+{
+    if (prng == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    return PRNG__range(prng, bound, value);
+}
+
+/**
+ * @brief Sets the state of a generator from a seed.
+ *
+ * @param prng Generator.
+ * @param seed Any value.
+ */
+static void PRNG__seed(PRNG_t* prng, uint32_t seed)
+{
+    prng->stream = seed;
+    
+    for (uint8_t i = 0; i < PRNG_STATE_WORDS; ++i)
+    {
+        prng->stream += PRNG__GOLDEN;
+        prng->state[i] = PRNG__mix(prng->stream);
+    }
+    
+    /* The mix is a bijection, at most one of the words can be 0 */
+}
+
+/**
+ * @brief Returns an unbiased value in [0, bound) from a generator.
+ *
+ * The upper half of value * bound is the result. Only the
+ * (2^32 mod bound) lowest products of a residue class are rejected, the
+ * division is skipped as long as the low half shows no bias is possible.
+ *
+ * @param prng Generator.
+ * @param bound Number of possible values, valid range 1...0xFFFFFFFF.
+ * @param value Pointer receiving the value, range 0...bound-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+static RC_t PRNG__range(PRNG_t* prng, uint32_t bound, uint32_t* value)
+{
+    if (value == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (bound == 0)
+    {
+        return RC_ERROR_ZERO;
+    }
+    
+    uint64_t product = (uint64_t)PRNG__next(prng) * bound;
+    
+    if ((uint32_t)product < bound)
+    {
+        /* 2^32 mod bound */
+        uint32_t threshold = (0u - bound) % bound;
+        
+        while ((uint32_t)product < threshold)
+        {
+            product = (uint64_t)PRNG__next(prng) * bound;
+        }
+    }
+    
+    *value = (uint32_t)(product >> 32);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Rotates left.
+ *
+ * @param x Value.
+ * @param k Bits, valid range 1...31.
+ * @return Rotated value.
+ */
+static uint32_t PRNG__rotl(uint32_t x, uint8_t k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+/**
+ * @brief splitmix32 finaliser, a bijection which changes every output bit
+ *        with probability close to 1/2 for any changed input bit.
+ *
+ * @param x Value.
+ * @return Mixed value.
+ */
+static uint32_t PRNG__mix(uint32_t x)
+{
+    x = (x ^ (x >> 16)) * 0x85EBCA6Bu;
+    x = (x ^ (x >> 13)) * 0xC2B2AE35u;
+    
+    return x ^ (x >> 16);
+}
+
+/**
+ * @brief xoshiro128** step.
+ *
+ * @param prng Generator.
+ * @return Next value.
+ */
+static uint32_t PRNG__next(PRNG_t* prng)
+{
+    uint32_t* state = prng->state;
+    uint32_t result = PRNG__rotl(state[1] * 5u, 7) * 9u;
+    uint32_t t = state[1] << 9;
+    
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = PRNG__rotl(state[3], 11);
+    
+    return result;
+}
@@ -0,0 +1,178 @@
+/**
+* \file prng.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Small state pseudo random number generator
+*
+* xoshiro128** generator: 16 byte state, only 32 bit shifts, rotations and
+* multiplications, no dependency on the reentrant rand() of newlib. The
+* state is seeded and stirred through a splitmix32 finaliser, so samples
+* with few random bits, like timer values taken at unpredictable events,
+* still change every state bit. Bounded values are drawn without modulo
+* bias by multiply-and-reject.
+*
+* The PRNG_Init() ... PRNG_Range() functions share the generator of the game.
+* Users which must not shift its sequence, e.g. a benchmark, create their
+* own PRNG_t.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef PRNG_H
+#define PRNG_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define PRNG_STATE_WORDS    4       /**< xoshiro128** state size */
+
+//####################### STRUCTURES
+
+/**
+ * @brief Generator instance, to be set up by PRNG_Create().
+ */
+typedef struct {
+    uint32_t state[PRNG_STATE_WORDS];   /**< Generator state, never all zero */
+    uint32_t stream;                    /**< splitmix32 counter of the seeding stream */
+} PRNG_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class PRNG
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Sets the generator state from a seed.
+ *
+ * The generator is usable without this call, but then always produces the
+ * same sequence after reset.
+ *
+ * @param seed Any value, e.g. a timer value.
+ * @return RC_SUCCESS
+ */
+RC_t PRNG_Init(uint32_t seed);
+
+/**
+ * @brief Stirs an entropy sample into the generator state.
+ *
+ * Intended for timer values taken at events with unpredictable timing, e.g.
+ * a button press. Not reentrant, call from the same context as PRNG_Next().
+ *
+ * @param sample Any value.
+ * @return RC_SUCCESS
+ */
+RC_t PRNG_AddEntropy(uint32_t sample);
+
+/**
+ * @brief Returns the next 32 bit value.
+ *
+ * @param value Pointer receiving the value, full range.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t PRNG_Next(uint32_t* value);
+
+/**
+ * @brief Returns an unbiased value in [0, bound).
+ *
+ * @param bound Number of possible values, valid range 1...0xFFFFFFFF.
+ * @param value Pointer receiving the value, range 0...bound-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t PRNG_Range(uint32_t bound, uint32_t* value);
+
+/**
+ * @brief Sets up an own generator instance from a seed.
+ *
+ * @param prng Instance to set up.
+ * @param seed Any value, the same seed gives the same sequence.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t PRNG_Create(PRNG_t* prng, uint32_t seed);
+
+/**
+ * @brief Returns an unbiased value in [0, bound) from an own generator instance.
+ *
+ * @param prng Instance set up by PRNG_Create().
+ * @param bound Number of possible values, valid range 1...0xFFFFFFFF.
+ * @param value Pointer receiving the value, range 0...bound-1.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_ZERO.
+ */
+RC_t PRNG_Draw(PRNG_t* prng, uint32_t bound, uint32_t* value);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* PRNG_H */
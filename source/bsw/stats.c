@@ -0,0 +1,239 @@
+/**
+* \file stats.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Streaming statistics of 16 bit samples in constant memory
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "stats.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define STATS__COUNT_MAX    0xFFFFu                         /**< Samples until STATS_Add() refuses */
+#define STATS__HALF         (1L << (STATS_FRAC_BITS - 1))   /**< 0.5 with STATS_FRAC_BITS fractional bits */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+static uint16_t STATS__percentile(const STATS_t* stats, uint8_t percent);
+static uint32_t STATS__sqrt(uint64_t value);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Discards all samples.
+ *
+ * @param stats Statistics to clear.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t STATS_Reset(STATS_t* stats)
+{
+    if (stats == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    stats->count = 0;
+    stats->min = 0xFFFFu;
+    stats->max = 0;
+    stats->mean = 0;
+    stats->m2 = 0;
+    for (uint8_t i = 0; i < STATS_BUCKETS; ++i)
+    {
+        stats->histogram[i] = 0;
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Adds one sample, O(1).
+ *
+ * @param stats Statistics initialised by STATS_Reset().
+ * @param sample Sample, valid range 0...65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_OVERRUN if 65535 samples
+ *         have been added already (the sample is dropped).
+ */
+RC_t STATS_Add(STATS_t* stats, uint16_t sample)
+{
+    if (stats == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (stats->count == STATS__COUNT_MAX)
+    {
+        return RC_ERROR_OVERRUN;
+    }
+    
+    ++stats->count;
+    
+    if (sample < stats->min)
+    {
+        stats->min = sample;
+    }
+    if (sample > stats->max)
+    {
+        stats->max = sample;
+    }
+    
+    /* Welford: the deviation from the old and from the new mean */
+    sint32_t x = (sint32_t)sample << STATS_FRAC_BITS;
+    sint32_t delta = x - stats->mean;
+    sint32_t step = ((delta >= 0) ? (delta + stats->count / 2) : (delta - stats->count / 2)) / stats->count;
+    
+    stats->mean += step;
+    stats->m2 += (sint64_t)delta * (x - stats->mean);
+    
+    /* Both deviations have the same sign, rounding of the mean can break that for tiny values */
+    if (stats->m2 < 0)
+    {
+        stats->m2 = 0;
+    }
+    
+    uint16_t bucket = sample / STATS_BUCKET_WIDTH;
+    
+    if (bucket >= STATS_BUCKETS)
+    {
+        bucket = STATS_BUCKETS - 1;
+    }
+    
+    ++stats->histogram[bucket];
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Computes the summary of the samples added so far.
+ *
+ * @param stats Statistics initialised by STATS_Reset().
+ * @param summary Pointer receiving the summary.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_EMTPY without samples.
+ */
+RC_t STATS_GetSummary(const STATS_t* stats, STATS_summary_t* summary)
+{
+    if ((stats == NULL) || (summary == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (stats->count == 0)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+    
+    summary->count = stats->count;
+    summary->min = stats->min;
+    summary->max = stats->max;
+    summary->mean = (uint16_t)((stats->mean + STATS__HALF) >> STATS_FRAC_BITS);
+    
+    /* Sample variance keeps 2 * STATS_FRAC_BITS fractional bits, its root STATS_FRAC_BITS */
+    summary->stddev = 0;
+    if (stats->count > 1)
+    {
+        uint32_t root = STATS__sqrt((uint64_t)stats->m2 / (stats->count - 1));
+        
+        summary->stddev = (uint16_t)((root + STATS__HALF) >> STATS_FRAC_BITS);
+    }
+    
+    summary->p50 = STATS__percentile(stats, 50);
+    summary->p90 = STATS__percentile(stats, 90);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Upper bound of the bucket containing the given percentile, limited to min...max.
+ *
+ * @param stats Statistics with at least one sample.
+ * @param percent Percentile 1..100.
+ * @return Percentile in sample units.
+ */
+static uint16_t STATS__percentile(const STATS_t* stats, uint8_t percent)
+{
+    /* Rank of the sample, rounded up */
+    uint32_t rank = ((uint32_t)stats->count * percent + 99) / 100;
+    uint32_t seen = 0;
+    uint8_t i;
+    
+    for (i = 0; i < STATS_BUCKETS - 1; ++i)
+    {
+        seen += stats->histogram[i];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    
+    uint32_t bound = ((uint32_t)i + 1) * STATS_BUCKET_WIDTH - 1;
+    
+    /* The last bucket is open ended */
+    if (bound > stats->max)
+    {
+        bound = stats->max;
+    }
+    if (bound < stats->min)
+    {
+        bound = stats->min;
+    }
+
+    return (uint16_t)bound;
+}
+
+/**
+ * @brief Integer square root, rounded down.
+ *
+ * @param value Radicand.
+ * @return floor(sqrt(value)).
+ */
+static uint32_t STATS__sqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    
+    /* Digit by digit, one result bit per iteration */
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
@@ -0,0 +1,165 @@
+/**
+* \file stats.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Streaming statistics of 16 bit samples in constant memory
+*
+* Every sample updates count, min/max, the running mean and the sum of
+* squared deviations (Welford) and one histogram bucket, all in O(1) and
+* integer arithmetic. Mean and deviations are kept with STATS_FRAC_BITS
+* fractional bits, so the variance does not suffer from the cancellation of
+* the sum / sum of squares method. Percentiles are read from the fixed
+* bucket histogram when a summary is requested.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+ 
+ 
+#ifndef STATS_H
+#define STATS_H
+
+#include "global.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define STATS_BUCKET_WIDTH      20      /**< Width of one histogram bucket [sample units] */
+#define STATS_BUCKETS           52      /**< Number of buckets, the last one collects everything above */
+#define STATS_FRAC_BITS         8       /**< Fractional bits of the running mean */
+
+//####################### STRUCTURES
+
+/**
+ * @brief Running statistics, initialise with STATS_Reset().
+ */
+typedef struct {
+    uint16_t count;                         /**< Number of samples */
+    uint16_t min;                           /**< Smallest sample */
+    uint16_t max;                           /**< Largest sample */
+    sint32_t mean;                          /**< Running mean, STATS_FRAC_BITS fractional bits */
+    sint64_t m2;                            /**< Sum of squared deviations, 2 * STATS_FRAC_BITS fractional bits */
+    uint16_t histogram[STATS_BUCKETS];      /**< Samples per bucket */
+} STATS_t;
+
+/**
+ * @brief Summary of the samples, all values in sample units and rounded.
+ *
+ * Percentiles are the upper bound of the histogram bucket they fall into,
+ * limited to min...max. min and max are exact.
+ */
+typedef struct {
+    uint16_t count;     /**< Number of samples */
+    uint16_t min;       /**< Smallest sample */
+    uint16_t mean;      /**< Mean */
+    uint16_t stddev;    /**< Sample standard deviation, 0 for a single sample */
+    uint16_t p50;       /**< Median */
+    uint16_t p90;       /**< 90th percentile */
+    uint16_t max;       /**< Largest sample */
+} STATS_summary_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class STATS
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Discards all samples.
+ *
+ * @param stats Statistics to clear.
+ * @return RC_SUCCESS or RC_ERROR_NULL.
+ */
+RC_t STATS_Reset(STATS_t* stats);
+
+/**
+ * @brief Adds one sample, O(1).
+ *
+ * @param stats Statistics initialised by STATS_Reset().
+ * @param sample Sample, valid range 0...65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_OVERRUN if 65535 samples
+ *         have been added already (the sample is dropped).
+ */
+RC_t STATS_Add(STATS_t* stats, uint16_t sample);
+
+/**
+ * @brief Computes the summary of the samples added so far.
+ *
+ * @param stats Statistics initialised by STATS_Reset().
+ * @param summary Pointer receiving the summary.
+ * @return RC_SUCCESS, RC_ERROR_NULL or RC_ERROR_BUFFER_EMTPY without samples.
+ */
+RC_t STATS_GetSummary(const STATS_t* stats, STATS_summary_t* summary);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* STATS_H */
@@ -0,0 +1,460 @@
+/**
+* \file swtimer.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Software timers multiplexed on the Counter component
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "swtimer.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+#define SWTIMER__CYCLES_PER_COUNT   (BCLK__BUS_CLK__HZ / SWTIMER_COUNTER_HZ)    /**< Time base ticks per Counter count */
+
+#define SWTIMER__PARENT(index)      (((index) - 1U) / 2U)
+#define SWTIMER__LEFT(index)        ((2U * (index)) + 1U)
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Pending expiry of a timer, ordered by expiry in the heap.
+ */
+typedef struct {
+    TIMEBASE_time_t expiry;     /**< Due time on the time base */
+    SWTIMER_t* timer;           /**< Timer to expire */
+    uint32_t generation;        /**< Generation of the timer when the entry was made, wide enough not to repeat while the entry is pending */
+} SWTIMER__entry_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/* Min-heap on expiry, only accessed with interrupts suspended */
+static SWTIMER__entry_t SWTIMER__heap[SWTIMER_HEAP_SIZE];
+static uint8_t SWTIMER__count = 0;
+static uint16_t SWTIMER__lost = 0;     /**< Periodic timers stopped for lack of room, saturating */
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/**
+ * @brief Checks whether the timer was cancelled or restarted after the entry was made.
+ *
+ * @param entry Heap entry.
+ * @return TRUE if the entry must not expire.
+ */
+static boolean_t SWTIMER__isStale(const SWTIMER__entry_t* entry);
+
+/**
+ * @brief Moves an entry towards the root until its parent is not later.
+ *
+ * @param index Position of the entry, valid range 0...SWTIMER__count-1.
+ */
+static void SWTIMER__siftUp(uint8_t index);
+
+/**
+ * @brief Moves an entry towards the leaves until no child is earlier.
+ *
+ * @param index Position of the entry, valid range 0...SWTIMER__count-1.
+ */
+static void SWTIMER__siftDown(uint8_t index);
+
+/**
+ * @brief Adds an entry, drops the stale entries first if the heap is full.
+ *
+ * @param expiry Due time on the time base.
+ * @param timer Timer to expire, its current generation is recorded.
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL.
+ */
+static RC_t SWTIMER__push(TIMEBASE_time_t expiry, SWTIMER_t* timer);
+
+/**
+ * @brief Removes the root entry.
+ */
+static void SWTIMER__pop(void);
+
+/**
+ * @brief Drops all stale entries and rebuilds the heap.
+ */
+static void SWTIMER__compact(void);
+
+/**
+ * @brief Programs the Counter one shot to the earliest pending expiry, stops it if there is none.
+ *
+ * @param now Current time base value.
+ */
+static void SWTIMER__program(TIMEBASE_time_t now);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the Counter and its clock and clears all pending expiries.
+ *
+ * TIMEBASE_Init() must have been called before.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t SWTIMER_Init(void)
+{
+    Clock_Counter_RG_Start();
+
+    SuspendAllInterrupts();
+    SWTIMER__count = 0;
+    SWTIMER__lost = 0;
+    /* Initialises the component, it is only started again by SWTIMER__program() */
+    Counter_Start();
+    Counter_Stop();
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Sets up a stopped timer.
+ *
+ * @param timer Timer to set up, must not be pending.
+ * @param callback Function called on expiry.
+ * @param context Passed to the callback, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_Create(SWTIMER_t* timer, SWTIMER_callback_t callback, void* context)
+{
+    if ((timer == NULL) || (callback == NULL))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    timer->callback = callback;
+    timer->context = context;
+    timer->period = 0;
+    timer->generation = 0;
+    timer->active = FALSE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Starts or restarts a timer, may be called from any task or ISR2.
+ *
+ * @param timer Timer set up by SWTIMER_Create().
+ * @param delayMs Time to the first expiry [ms], 0 expires on the next Counter interrupt.
+ * @param periodMs Time between further expiries [ms], 0 for a one shot timer.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BUFFER_FULL if the heap only holds pending timers.
+ */
+RC_t SWTIMER_Start(SWTIMER_t* timer, uint32_t delayMs, uint32_t periodMs)
+{
+    if (timer == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    SuspendAllInterrupts();
+
+    // A new generation invalidates the entry of a previous start
+    timer->generation++;
+    timer->period = (TIMEBASE_time_t)periodMs * TIMEBASE_CYCLES_PER_MS;
+    timer->active = TRUE;
+
+    TIMEBASE_time_t now = TIMEBASE_Now();
+    RC_t rc = SWTIMER__push(now + ((TIMEBASE_time_t)delayMs * TIMEBASE_CYCLES_PER_MS), timer);
+
+    if (rc != RC_SUCCESS)
+    {
+        timer->active = FALSE;
+    }
+    else if (SWTIMER__heap[0].timer == timer)
+    {
+        // New earliest expiry, the Counter is still set for a later one
+        SWTIMER__program(now);
+    }
+
+    ResumeAllInterrupts();
+
+    return rc;
+}
+
+/**
+ * @brief Stops a timer in constant time, may be called from any task or ISR2.
+ *
+ * A callback which is already running is not waited for.
+ *
+ * @param timer Timer set up by SWTIMER_Create().
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_Cancel(SWTIMER_t* timer)
+{
+    if (timer == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    // The heap entry stays, it is dropped when it reaches the root
+    SuspendAllInterrupts();
+    timer->generation++;
+    timer->active = FALSE;
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Runs the callbacks of all due timers and programs the next expiry, called from isr_timer.
+ *
+ * A periodic timer whose next expiry finds no room in the heap is stopped
+ * after this callback, its loss is reported by the return value.
+ *
+ * @param expired Pointer receiving the number of callbacks run, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL if a periodic timer was stopped.
+ */
+RC_t SWTIMER_Expire(uint8_t* expired)
+{
+    uint8_t count = 0;
+    RC_t rc = RC_SUCCESS;
+    TIMEBASE_time_t now = TIMEBASE_Now();
+
+    SuspendAllInterrupts();
+
+    while ((SWTIMER__count > 0) && (SWTIMER__heap[0].expiry <= now))
+    {
+        SWTIMER__entry_t entry = SWTIMER__heap[0];
+        SWTIMER__pop();
+
+        if (SWTIMER__isStale(&entry) == TRUE)
+        {
+            continue;
+        }
+
+        // Periodic timers are re-inserted from their due time, so they do not drift
+        SWTIMER_t* timer = entry.timer;
+        if (timer->period != 0)
+        {
+            // The popped entry left room, a failure would need a bug elsewhere
+            if (SWTIMER__push(entry.expiry + timer->period, timer) != RC_SUCCESS)
+            {
+                timer->active = FALSE;
+                if (SWTIMER__lost < 0xFFFFU)
+                {
+                    SWTIMER__lost++;
+                }
+                rc = RC_ERROR_BUFFER_FULL;
+            }
+        }
+        else
+        {
+            timer->active = FALSE;
+        }
+
+        // The callback may start or cancel timers itself
+        ResumeAllInterrupts();
+        timer->callback(timer->context);
+        if (count < 0xFFU)
+        {
+            count++;
+        }
+        SuspendAllInterrupts();
+    }
+
+    SWTIMER__program(TIMEBASE_Now());
+
+    ResumeAllInterrupts();
+
+    if (expired != NULL)
+    {
+        *expired = count;
+    }
+
+    return rc;
+}
+
+/**
+ * @brief Reads the number of periodic timers SWTIMER_Expire() had to stop.
+ *
+ * @param lost Pointer receiving the count since SWTIMER_Init(), saturates at 65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_GetLost(uint16_t* lost)
+{
+    if (lost == NULL)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    SuspendAllInterrupts();
+    *lost = SWTIMER__lost;
+    ResumeAllInterrupts();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Checks whether the timer was cancelled or restarted after the entry was made.
+ *
+ * @param entry Heap entry.
+ * @return TRUE if the entry must not expire.
+ */
+static boolean_t SWTIMER__isStale(const SWTIMER__entry_t* entry)
+{
+    return ((entry->timer->active == FALSE) || (entry->generation != entry->timer->generation)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Moves an entry towards the root until its parent is not later.
+ *
+ * @param index Position of the entry, valid range 0...SWTIMER__count-1.
+ */
+static void SWTIMER__siftUp(uint8_t index)
+{
+    SWTIMER__entry_t entry = SWTIMER__heap[index];
+
+    while ((index > 0) && (SWTIMER__heap[SWTIMER__PARENT(index)].expiry > entry.expiry))
+    {
+        SWTIMER__heap[index] = SWTIMER__heap[SWTIMER__PARENT(index)];
+        index = SWTIMER__PARENT(index);
+    }
+    SWTIMER__heap[index] = entry;
+}
+
+/**
+ * @brief Moves an entry towards the leaves until no child is earlier.
+ *
+ * @param index Position of the entry, valid range 0...SWTIMER__count-1.
+ */
+static void SWTIMER__siftDown(uint8_t index)
+{
+    SWTIMER__entry_t entry = SWTIMER__heap[index];
+
+    while (SWTIMER__LEFT(index) < SWTIMER__count)
+    {
+        uint8_t child = SWTIMER__LEFT(index);
+
+        // Earlier of both children
+        if (((child + 1U) < SWTIMER__count) && (SWTIMER__heap[child + 1U].expiry < SWTIMER__heap[child].expiry))
+        {
+            child++;
+        }
+        if (SWTIMER__heap[child].expiry >= entry.expiry)
+        {
+            break;
+        }
+        SWTIMER__heap[index] = SWTIMER__heap[child];
+        index = child;
+    }
+    SWTIMER__heap[index] = entry;
+}
+
+/**
+ * @brief Adds an entry, drops the stale entries first if the heap is full.
+ *
+ * @param expiry Due time on the time base.
+ * @param timer Timer to expire, its current generation is recorded.
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL.
+ */
+static RC_t SWTIMER__push(TIMEBASE_time_t expiry, SWTIMER_t* timer)
+{
+    if (SWTIMER__count == SWTIMER_HEAP_SIZE)
+    {
+        SWTIMER__compact();
+    }
+    if (SWTIMER__count == SWTIMER_HEAP_SIZE)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+
+    SWTIMER__heap[SWTIMER__count].expiry = expiry;
+    SWTIMER__heap[SWTIMER__count].timer = timer;
+    SWTIMER__heap[SWTIMER__count].generation = timer->generation;
+    SWTIMER__count++;
+    SWTIMER__siftUp(SWTIMER__count - 1U);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Removes the root entry.
+ */
+static void SWTIMER__pop(void)
+{
+    SWTIMER__count--;
+    if (SWTIMER__count > 0)
+    {
+        SWTIMER__heap[0] = SWTIMER__heap[SWTIMER__count];
+        SWTIMER__siftDown(0);
+    }
+}
+
+/**
+ * @brief Drops all stale entries and rebuilds the heap.
+ */
+static void SWTIMER__compact(void)
+{
+    uint8_t kept = 0;
+
+    for (uint8_t i = 0; i < SWTIMER__count; i++)
+    {
+        if (SWTIMER__isStale(&SWTIMER__heap[i]) == FALSE)
+        {
+            SWTIMER__heap[kept] = SWTIMER__heap[i];
+            kept++;
+        }
+    }
+    SWTIMER__count = kept;
+
+    // Bottom-up rebuild, the leaves are heaps already
+    for (uint8_t i = kept / 2U; i > 0; i--)
+    {
+        SWTIMER__siftDown(i - 1U);
+    }
+}
+
+/**
+ * @brief Programs the Counter one shot to the earliest pending expiry, stops it if there is none.
+ *
+ * @param now Current time base value.
+ */
+static void SWTIMER__program(TIMEBASE_time_t now)
+{
+    while ((SWTIMER__count > 0) && (SWTIMER__isStale(&SWTIMER__heap[0]) == TRUE))
+    {
+        SWTIMER__pop();
+    }
+
+    Counter_Stop();
+    if (SWTIMER__count == 0)
+    {
+        return;
+    }
+
+    // Rounded up by one count, so the zero interrupt is never early
+    TIMEBASE_time_t counts = 1;
+    if (SWTIMER__heap[0].expiry > now)
+    {
+        counts = ((SWTIMER__heap[0].expiry - now) / SWTIMER__CYCLES_PER_COUNT) + 1U;
+    }
+    if (counts > SWTIMER_MAX_COUNTS)
+    {
+        // Longer delays take several shots
+        counts = SWTIMER_MAX_COUNTS;
+    }
+
+    Counter_WriteCounter((uint16)counts);
+    Counter_Start();
+}
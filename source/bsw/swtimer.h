@@ -0,0 +1,187 @@
+/**
+* \file swtimer.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Software timers multiplexed on the Counter component
+*
+* Any number of one shot and periodic timers share the 16 bit Counter. The
+* pending expiries are kept in a binary min-heap on the time base, the
+* Counter is programmed one shot to the earliest of them and isr_timer calls
+* SWTIMER_Expire(). Start is O(log n), cancel is O(1): it only invalidates the
+* timer's heap entry, which is dropped once it reaches the top of the heap or
+* when the heap is compacted on overflow.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef SWTIMER_H
+#define SWTIMER_H
+
+#include "global.h"
+#include "timebase.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define SWTIMER_HEAP_SIZE           32      /**< Pending expiries incl. cancelled ones, valid range 1...255 */
+#define SWTIMER_COUNTER_HZ          12000U  /**< Clock of the Counter component (Clock_Counter_RG) */
+#define SWTIMER_MAX_COUNTS          0xFFFFU /**< Longest single shot of the 16 bit Counter (5.4 s) */
+
+//####################### TYPES
+
+/**
+ * @brief Function called when a timer expires, runs in isr_timer (ISR2 rules apply).
+ *
+ * @param context Context given to SWTIMER_Create().
+ */
+typedef void (*SWTIMER_callback_t)(void* context);
+
+//####################### STRUCTURES
+
+/**
+ * @brief A software timer, owned by the caller and set up by SWTIMER_Create().
+ */
+typedef struct {
+    SWTIMER_callback_t callback;    /**< Called on expiry */
+    void* context;                  /**< Passed to the callback */
+    TIMEBASE_time_t period;         /**< Reload in time base ticks, 0 for a one shot timer */
+    uint32_t generation;            /**< Incremented by every start and cancel, invalidates older heap entries */
+    boolean_t active;               /**< TRUE between start and expiry (one shot) or cancel */
+} SWTIMER_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class SWTIMER
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the Counter and its clock and clears all pending expiries.
+ *
+ * TIMEBASE_Init() must have been called before.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t SWTIMER_Init(void);
+
+/**
+ * @brief Sets up a stopped timer.
+ *
+ * @param timer Timer to set up, must not be pending.
+ * @param callback Function called on expiry.
+ * @param context Passed to the callback, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_Create(SWTIMER_t* timer, SWTIMER_callback_t callback, void* context);
+
+/**
+ * @brief Starts or restarts a timer, may be called from any task or ISR2.
+ *
+ * @param timer Timer set up by SWTIMER_Create().
+ * @param delayMs Time to the first expiry [ms], 0 expires on the next Counter interrupt.
+ * @param periodMs Time between further expiries [ms], 0 for a one shot timer.
+ * @return RC_SUCCESS, RC_ERROR_NULL, RC_ERROR_BUFFER_FULL if the heap only holds pending timers.
+ */
+RC_t SWTIMER_Start(SWTIMER_t* timer, uint32_t delayMs, uint32_t periodMs);
+
+/**
+ * @brief Stops a timer in constant time, may be called from any task or ISR2.
+ *
+ * A callback which is already running is not waited for.
+ *
+ * @param timer Timer set up by SWTIMER_Create().
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_Cancel(SWTIMER_t* timer);
+
+/**
+ * @brief Runs the callbacks of all due timers and programs the next expiry, called from isr_timer.
+ *
+ * A periodic timer whose next expiry finds no room in the heap is stopped
+ * after this callback, its loss is reported by the return value.
+ *
+ * @param expired Pointer receiving the number of callbacks run, may be NULL.
+ * @return RC_SUCCESS, RC_ERROR_BUFFER_FULL if a periodic timer was stopped.
+ */
+RC_t SWTIMER_Expire(uint8_t* expired);
+
+/**
+ * @brief Reads the number of periodic timers SWTIMER_Expire() had to stop.
+ *
+ * @param lost Pointer receiving the count since SWTIMER_Init(), saturates at 65535.
+ * @return RC_SUCCESS, RC_ERROR_NULL.
+ */
+RC_t SWTIMER_GetLost(uint16_t* lost);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* SWTIMER_H */
@@ -0,0 +1,164 @@
+/**
+* \file timebase.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief 64 bit monotonic time base
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "project.h"
+#include "timebase.h"
+
+
+
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/* Only written with PRIMASK set, see TIMEBASE_Now32() */
+static volatile TIMEBASE_time_t TIMEBASE__now = 0;  /**< Time at the last read */
+static volatile uint32_t TIMEBASE__last = 0;        /**< Cycle counter at the last read */
+static volatile uint32_t TIMEBASE__scale = 1;       /**< Time base ticks per CPU cycle */
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/**
+ * @brief Adds the cycles since the last read, to be called with PRIMASK set.
+ *
+ * @return Current time
+ */
+static TIMEBASE_time_t TIMEBASE__update(void);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and the time base at 0.
+ *
+ * Must be called once before the first TIMEBASE_Now().
+ *
+ * @return RC_SUCCESS
+ */
+RC_t TIMEBASE_Init(void)
+{
+    CYCLE_Init();
+
+    uint8 state = CyEnterCriticalSection();
+    TIMEBASE__now = 0;
+    TIMEBASE__last = CYCLE_NOW();
+    CyExitCriticalSection(state);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Keeps the time base up to date, to be called every 1 ms from systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t TIMEBASE_Tick(void)
+{
+    (void)TIMEBASE_Now();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Returns the current time, may be called from any task or ISR2.
+ *
+ * @return Cycles at BCLK__BUS_CLK__HZ since TIMEBASE_Init()
+ */
+TIMEBASE_time_t TIMEBASE_Now(void)
+{
+    uint8 state = CyEnterCriticalSection();
+    TIMEBASE_time_t now = TIMEBASE__update();
+    CyExitCriticalSection(state);
+
+    return now;
+}
+
+/**
+ * @brief Returns the low 32 bit of the current time without updating the time base.
+ *
+ * Lock free, may be called from any task or ISR. All updates run with
+ * PRIMASK set, a read which was preempted by one is repeated. The kernel
+ * lock is not enough, with EE_CORTEX_MX_KERNEL_BASEPRI it leaves
+ * isr_buttons unmasked. Suited for polling, e.g. in a spin loop.
+ *
+ * @return Low 32 bit of the time, differences are valid up to 179 s
+ */
+uint32_t TIMEBASE_Now32(void)
+{
+    uint32_t last;
+    uint32_t now;
+
+    // Every update moves TIMEBASE__last, so an unchanged value means a consistent read
+    do
+    {
+        last = TIMEBASE__last;
+
+        // Modulo 2^32 throughout, only the low word of the accumulator is needed
+        now = (uint32_t)TIMEBASE__now + ((uint32_t)(CYCLE_NOW() - last) * TIMEBASE__scale);
+    } while (last != TIMEBASE__last);
+
+    return now;
+}
+
+/**
+ * @brief Weights the following CPU cycles with a new clock divider.
+ *
+ * To be called together with the change of the bus clock divider, both
+ * with PRIMASK set (CyEnterCriticalSection()).
+ *
+ * @param divider BCLK__BUS_CLK__HZ / CPU clock, valid range 1...65535
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM
+ */
+RC_t TIMEBASE_SetCpuDivider(uint16_t divider)
+{
+    if (divider == 0)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    // The cycles so far are weighted with the old divider
+    uint8 state = CyEnterCriticalSection();
+    (void)TIMEBASE__update();
+    TIMEBASE__scale = divider;
+    CyExitCriticalSection(state);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * @brief Adds the cycles since the last read, to be called with PRIMASK set.
+ *
+ * @return Current time
+ */
+static TIMEBASE_time_t TIMEBASE__update(void)
+{
+    // Unsigned difference, correct across one wrap of the cycle counter
+    uint32_t low = CYCLE_NOW();
+    TIMEBASE__now += (TIMEBASE_time_t)(low - TIMEBASE__last) * TIMEBASE__scale;
+    TIMEBASE__last = low;
+
+    return TIMEBASE__now;
+}
@@ -0,0 +1,169 @@
+/**
+* \file timebase.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief 64 bit monotonic time base
+*
+* Accumulates the 32 bit DWT cycle counter (wraps after 179 s at 24 MHz)
+* into 64 bit. Every read adds the cycles since the previous read,
+* systick_handler reads it every 1 ms through TIMEBASE_Tick(), so no wrap
+* can be missed. The time counts at the nominal BCLK__BUS_CLK__HZ: while the
+* CPU clock is divided (see governor.h) each cycle is weighted with the
+* divider. It never wraps in practice.
+*/
+
+/**
+ * Programming rules (may be deleted in the final release of the file)
+ * ===================================================================
+ *
+ * 1. Naming conventions:
+ *    - Prefix of your module in front of every function and static data. 
+ *    - Scope _ for public and __ for private functions / data / types, e.g. 
+ *       Public:  void CONTROL_straightPark_Init();
+ *       Private: static void CONTROL__calcDistance();
+ *       Public:  typedef enum {RED, GREEN, YELLOW} CONTROL_color_t
+ *    - Own type definitions e.g. for structs or enums get a postfix _t
+ *    - #define's and enums are written in CAPITAL letters
+ * 2. Code structure
+ *    - Be aware of the scope of your modules and functions. Provide only functions which belong to your module to your files
+ *    - Prepare your design before starting to code
+ *    - Implement the simple most solution (Too many if then else nestings are an indicator that you have not properly analysed your task)
+ *    - Avoid magic numbers, use enums and #define's instead
+ *    - Make sure, that all error conditions are properly handled
+ *    - If your module provides data structures, which are required in many other files, it is recommended to place them in a file_type.h file
+ *	  - If your module contains configurable parts, is is recommended to place these in a file_config.h|.c file
+ * 3. Data conventions
+ *    - Minimize the scope of data (and functions)
+ *    - Global data is not allowed outside of the signal layer (in case a signal layer is part of your design)
+ *    - All static objects have to be placed in a valid linker sections
+ *    - Data which is accessed in more than one task has to be volatile and needs to be protected (e.g. by using messages or semaphores)
+ *    - Do not mix signed and unsigned data in the same operation
+ * 4. Documentation
+ *    - Use self explaining function and variable names
+ *    - Use proper indentation
+ *    - Provide Javadoc / Doxygen compatible comments in your header file and C-File
+ *    		- Every  File has to be documented in the header
+ *			- Every function parameter and return value must be documented, the valid range needs to be specified
+ *     		- Logical code blocks in the C-File must be commented
+ *    - For a detailed list of doxygen commands check http://www.stack.nl/~dimitri/doxygen/index.html 
+ * 5. Qualification
+ *    - Perform and document design and code reviews for every module
+ *    - Provide test specifications for every module (focus on error conditions)
+ *
+ * Further information:
+ *    - Check the programming rules defined in the MIMIR project guide
+ *         - Code structure: https://fromm.eit.h-da.de/intern/mimir/methods/eng_codestructure/method.htm
+ *         - MISRA for C: https://fromm.eit.h-da.de/intern/mimir/methods/eng_c_rules/method.htm
+ *         - MISRA for C++: https://fromm.eit.h-da.de/intern/mimir/methods/eng_cpp_rules/method.htm 
+ **/
+ 
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include "global.h"
+#include "cyfitter.h"
+#include "cycle.h"
+    
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### MACROS
+
+#define TIMEBASE_CYCLES_PER_MS      (BCLK__BUS_CLK__HZ / 1000U)     /**< Time base ticks per millisecond */
+#define TIMEBASE_CYCLES_PER_US      (BCLK__BUS_CLK__HZ / 1000000U)  /**< Time base ticks per microsecond */
+
+/** Time elapsed since a previous TIMEBASE_Now() value */
+#define TIMEBASE_SINCE(start)       ((TIMEBASE_time_t)(TIMEBASE_Now() - (TIMEBASE_time_t)(start)))
+
+/** Conversion of a time or an interval into milliseconds */
+#define TIMEBASE_TO_MS(time)        ((TIMEBASE_time_t)(time) / TIMEBASE_CYCLES_PER_MS)
+
+/** Conversion of a time or an interval into microseconds */
+#define TIMEBASE_TO_US(time)        ((TIMEBASE_time_t)(time) / TIMEBASE_CYCLES_PER_US)
+
+//####################### TYPES
+
+/**
+ * @brief Point in time or interval in cycles at BCLK__BUS_CLK__HZ.
+ */
+typedef uint64_t TIMEBASE_time_t;
+
+// Wrapper to allow representing the file in Together as class
+#ifdef TOGETHER
+
+class TIMEBASE
+{
+public:
+#endif /* Together */
+
+/*****************************************************************************/
+/* Extern global variables                                                   */
+/*****************************************************************************/
+
+
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Starts the cycle counter and the time base at 0.
+ *
+ * Must be called once before the first TIMEBASE_Now().
+ *
+ * @return RC_SUCCESS
+ */
+RC_t TIMEBASE_Init(void);
+
+/**
+ * @brief Keeps the time base up to date, to be called every 1 ms from systick_handler.
+ *
+ * @return RC_SUCCESS
+ */
+RC_t TIMEBASE_Tick(void);
+
+/**
+ * @brief Returns the current time, may be called from any task or ISR2.
+ *
+ * @return Cycles at BCLK__BUS_CLK__HZ since TIMEBASE_Init()
+ */
+TIMEBASE_time_t TIMEBASE_Now(void);
+
+/**
+ * @brief Returns the low 32 bit of the current time without updating the time base.
+ *
+ * Lock free, may be called from any task or ISR. All updates run with
+ * PRIMASK set, a read which was preempted by one is repeated. The kernel
+ * lock is not enough, with EE_CORTEX_MX_KERNEL_BASEPRI it leaves
+ * isr_buttons unmasked. Suited for polling, e.g. in a spin loop.
+ *
+ * @return Low 32 bit of the time, differences are valid up to 179 s
+ */
+uint32_t TIMEBASE_Now32(void);
+
+/**
+ * @brief Weights the following CPU cycles with a new clock divider.
+ *
+ * To be called together with the change of the bus clock divider, both
+ * with PRIMASK set (CyEnterCriticalSection()).
+ *
+ * @param divider BCLK__BUS_CLK__HZ / CPU clock, valid range 1...65535
+ * @return RC_SUCCESS, RC_ERROR_BAD_PARAM
+ */
+RC_t TIMEBASE_SetCpuDivider(uint16_t divider);
+
+
+/*****************************************************************************/
+/* Private stuff, only visible for Together, declared static in cpp - File   */
+/*****************************************************************************/
+
+
+#ifdef TOGETHER
+//Not visible for compiler, only used for document generation
+private:
+};
+#endif /* Together */
+
+#endif /* TIMEBASE_H */
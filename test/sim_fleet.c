@@ -0,0 +1,578 @@
+/**
+* \file sim_fleet.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host fleet simulation of many boards on a work-stealing pool
+*
+* Every device is a board of board.c with its own Game_t, Fader_t,
+* RGBGlower_t and virtual counter, driven in virtual time by BOARD_Tick().
+* Its tick work plays the game of reactionGame.c against a simulated player,
+* the UART output of the game is counted and hashed per device.
+*
+* A device is a stackless coroutine: a resume advances its board by a slice
+* of ticks with BOARD_RunFleet() and returns, its state lives in the board
+* and the device. The workers, one thread per core, keep the devices to
+* resume in Chase-Lev deques: the owner pushes and takes at the bottom, an
+* idle worker steals from the top of another one. No lock is taken.
+*
+* The same fleet is run once in lockstep by BOARD_RunFleet() on one thread
+* and once on the pool. The devices do not interact, so both runs have to
+* produce the same UART traffic per device. The benchmark prints simulated
+* device-seconds per wall-second of both.
+*
+* The game generator of prng.c and the display are module state, so the
+* devices draw their delays and digits from their own generator and the
+* display stubs keep one display per device.
+*
+* make -C test sim, or build/sim_fleet [devices] [virtual seconds] [workers]
+*/
+
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "unit.h"
+#include "project.h"
+/* Before the bsw headers, which would find the real one next to them */
+#include "cycle.h"
+#include "arcadian.h"
+#include "../source/asw/board.c"
+#include "../source/asw/reactionGame.c"
+#include "../source/bsw/stats.c"
+#include "../source/bsw/prng.c"
+#include "../source/bsw/fmt.c"
+
+/*****************************************************************************/
+/* Parameters of the simulation                                              */
+/*****************************************************************************/
+
+#define SIM__DEVICES        256u        /**< Default devices of the fleet */
+#define SIM__SECONDS        600u        /**< Default virtual time [s] */
+#define SIM__SLICE_MS       1000u       /**< Ticks of one resume, 1 ms each */
+#define SIM__WORKERS_MAX    64u
+#define SIM__EMPTY          0xFFFFFFFFu /**< No device taken from a deque */
+#define SIM__SEED           0xF1EE7000u /**< Seed of the first device */
+#define SIM__NEXT_ROUND_MS  500u        /**< Press which starts the next round [ms] */
+#define SIM__NEXT_GAME_MS   3000u       /**< Reading the results of a game [ms] */
+#define SIM__FNV_OFFSET     2166136261u
+#define SIM__FNV_PRIME      16777619u
+
+/** Reaction time mu + sigma * N(0, 1) + tau * Exp(1) of a typical player [ms] */
+#define SIM__MU             340.0
+#define SIM__SIGMA          40.0
+#define SIM__TAU            100.0
+#define SIM__ERRORS         0.04        /**< Share of presses on the wrong side */
+
+typedef enum {
+    SIM__WAIT_START = 0,        /**< IsWaitingRoundStart */
+    SIM__WAIT_DISPLAY,          /**< IsWaitingDisplay */
+    SIM__WAIT_REACTION          /**< IsWaitingUserReaction */
+} SIM__state_t;
+
+/** Application and player of one board */
+typedef struct {
+    Game_t game;
+    Fader_t fader;
+    RGBGlower_t glower;
+    PRNG_t rng;                 /**< Game and player draws of the device */
+    sint8_t display[2];         /**< SEVEN_0 and SEVEN_1 */
+    SIM__state_t state;
+    uint64_t dueMs;             /**< Board time of the next event */
+    uint64_t shownMs;           /**< Board time the digit was shown */
+    boolean_t timeout;          /**< The running round ends without a press */
+    uint8_t buttons;            /**< Buttons of the press of the running round */
+    uint32_t games;             /**< Games played to the end */
+    uint64_t uartBytes;
+    uint32_t uartHash;          /**< FNV-1a of the UART output */
+} SIM__device_t;
+
+/** Work-stealing deque of device indices, Chase-Lev with a fixed capacity */
+typedef struct {
+    _Atomic int64_t top;
+    _Atomic int64_t bottom;
+    _Atomic uint32_t* items;
+    uint32_t mask;
+} SIM__deque_t;
+
+typedef struct {
+    pthread_t thread;
+    SIM__deque_t deque;
+    PRNG_t victims;             /**< Picks the worker to steal from */
+    uint32_t id;
+    uint64_t resumes;
+    uint64_t steals;
+} SIM__worker_t;
+
+/*****************************************************************************/
+/* Fleet state                                                               */
+/*****************************************************************************/
+
+uint32_t CYCLE_hostNow;
+
+static BOARD_t* SIM__boards;
+static SIM__device_t* SIM__devices;
+static uint32_t SIM__deviceCount;
+static uint64_t SIM__endMs;
+static SIM__worker_t SIM__workers[SIM__WORKERS_MAX];
+static uint32_t SIM__workerCount;
+static _Atomic uint32_t SIM__finished;
+
+/** Device whose tick work runs on this thread */
+static __thread SIM__device_t* SIM__current;
+
+/*****************************************************************************/
+/* Board stubs, routed to the device of the running tick work                */
+/*****************************************************************************/
+
+RC_t CYCLE_Init(void)
+{
+    return RC_SUCCESS;
+}
+
+void UART_Logs_Start(void)
+{
+}
+
+void UART_Logs_PutString(const char8 string[])
+{
+    SIM__device_t* device = SIM__current;
+
+    for (const char8* c = string; *c != '\0'; ++c)
+    {
+        device->uartHash = (device->uartHash ^ (uint8_t)*c) * SIM__FNV_PRIME;
+        ++device->uartBytes;
+    }
+}
+
+RC_t SEVEN_Init()
+{
+    SIM__current->display[SEVEN_0] = 0;
+    SIM__current->display[SEVEN_1] = 0;
+    return RC_SUCCESS;
+}
+
+RC_t SEVEN_Set(SEVEN_id_t sevenId, uint8_t value)
+{
+    SIM__current->display[sevenId] = (sint8_t)value;
+    return RC_SUCCESS;
+}
+
+RC_t SEVEN_Get(SEVEN_id_t sevenId, sint8_t* value)
+{
+    *value = SIM__current->display[sevenId];
+    return RC_SUCCESS;
+}
+
+/* The round timeout is an event of the device, no software timer is armed */
+RC_t SWTIMER_Create(SWTIMER_t* timer, SWTIMER_callback_t callback, void* context)
+{
+    (void)timer;
+    (void)callback;
+    (void)context;
+    return RC_SUCCESS;
+}
+
+RC_t SWTIMER_Start(SWTIMER_t* timer, uint32_t delayMs, uint32_t periodMs)
+{
+    (void)timer;
+    (void)delayMs;
+    (void)periodMs;
+    return RC_SUCCESS;
+}
+
+RC_t SWTIMER_Cancel(SWTIMER_t* timer)
+{
+    (void)timer;
+    return RC_SUCCESS;
+}
+
+RC_t CAPTURE_StartRound(TIMEBASE_time_t start)
+{
+    (void)start;
+    return RC_SUCCESS;
+}
+
+TIMEBASE_time_t TIMEBASE_Now(void)
+{
+    return 0;
+}
+
+RC_t REPLAY_Value(REPLAY_kind_t kind, uint32_t* value)
+{
+    (void)kind;
+    (void)value;
+    return RC_SUCCESS;
+}
+
+/*****************************************************************************/
+/* Device                                                                    */
+/*****************************************************************************/
+
+/** Uniform in (0, 1) */
+static double SIM__uniform(PRNG_t* rng)
+{
+    uint32_t value = 0;
+    (void)PRNG_Draw(rng, 0xFFFFFFFFu, &value);
+    return (value + 0.5) / 4294967296.0;
+}
+
+/** 1...limit, as REACTION_generateRandomNum() from the device generator */
+static uint16_t SIM__draw(PRNG_t* rng, uint8_t limit)
+{
+    uint32_t value = 0;
+    (void)PRNG_Draw(rng, limit, &value);
+    return (uint16_t)(value + 1);
+}
+
+static uint32_t SIM__reactionMs(PRNG_t* rng)
+{
+    double const normal = sqrt(-2.0 * log(SIM__uniform(rng))) * cos(2.0 * M_PI * SIM__uniform(rng));
+    double const ms = SIM__MU + SIM__SIGMA * normal - SIM__TAU * log(SIM__uniform(rng));
+
+    return (ms > 0.0) ? (uint32_t)ms : 0;
+}
+
+/**
+ * Tick work of a device board, the game events of main.c at the board time:
+ * round start, digit, then press or timeout.
+ */
+static void SIM__onTick(BOARD_t* board)
+{
+    SIM__device_t* device = &SIM__devices[board - SIM__boards];
+    Game_t* game = &device->game;
+
+    if (board->counter.elapsed < device->dueMs)
+    {
+        return;
+    }
+    SIM__current = device;
+
+    switch (device->state)
+    {
+    case SIM__WAIT_START:
+        if (game->roundNumber > game->maxRounds)
+        {
+            (void)REACTION_displayDetails(game);
+            (void)REACTION_resetGame(game);
+            ++device->games;
+            device->dueMs += SIM__NEXT_GAME_MS;
+            break;
+        }
+        (void)REACTION_printRoundNumber(game->roundNumber);
+        device->dueMs += SIM__draw(&device->rng, REACTION_DELAY_MAX_SEC) * 1000u;
+        device->state = SIM__WAIT_DISPLAY;
+        break;
+
+    case SIM__WAIT_DISPLAY:
+    {
+        uint16_t const digit = SIM__draw(&device->rng, 2);
+        uint32_t const roundMs = game->durationOfRoundSec * 1000u;
+        uint32_t const reactionMs = SIM__reactionMs(&device->rng);
+
+        (void)REACTION_setDisplay(digit);
+        (void)REACTION_startRoundTimer(game);
+        device->shownMs = board->counter.elapsed;
+        device->buttons = ((digit == 1) != (SIM__uniform(&device->rng) < SIM__ERRORS))
+                          ? CAPTURE_BUTTON_MASK(Button_Right_1) : CAPTURE_BUTTON_MASK(Button_Left_1);
+        device->timeout = (reactionMs >= roundMs) ? TRUE : FALSE;
+        device->dueMs += (device->timeout == TRUE) ? roundMs : reactionMs;
+        device->state = SIM__WAIT_REACTION;
+        break;
+    }
+
+    case SIM__WAIT_REACTION:
+    {
+        /* The press is checked against the display it was made on */
+        boolean_t const correct = REACTION_correctButtonPressed(device->buttons);
+
+        (void)REACTION_stopRoundTimer(game);
+        (void)REACTION_resetDisplay();
+        if (device->timeout == TRUE)
+        {
+            (void)REACTION_displayTimeoutMessage();
+        }
+        else if (correct == TRUE)
+        {
+            uint16_t reaction = 0;
+            (void)REACTION_getReactionTimeMS(&reaction, game, (uint16_t)(board->counter.elapsed - device->shownMs));
+            (void)STATS_Add(&game->reactionTimes, reaction);
+            (void)REACTION_displaySuccessMessage(reaction);
+        }
+        else
+        {
+            (void)REACTION_displayFailureMessage();
+        }
+        ++game->roundNumber;
+        device->dueMs += SIM__NEXT_ROUND_MS;
+        device->state = SIM__WAIT_START;
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+/** Sets up the fleet, every device from its own seed */
+static void SIM__setup(void)
+{
+    for (uint32_t d = 0; d < SIM__deviceCount; ++d)
+    {
+        SIM__device_t* device = &SIM__devices[d];
+
+        memset(device, 0, sizeof(*device));
+        device->uartHash = SIM__FNV_OFFSET;
+        device->state = SIM__WAIT_START;
+        device->dueMs = SIM__NEXT_ROUND_MS;
+        (void)PRNG_Create(&device->rng, SIM__SEED + d);
+
+        SIM__current = device;
+        (void)REACTION_init(&device->game, NULL);
+        (void)BOARD_Create(&SIM__boards[d], (struct Game_t*)&device->game, (struct Fader_t*)&device->fader,
+                           (struct RGBGlower_t*)&device->glower, 0xFFFFFFFFu, 1, SIM__onTick);
+    }
+}
+
+/*****************************************************************************/
+/* Work-stealing pool                                                        */
+/*****************************************************************************/
+
+static void SIM__dequeCreate(SIM__deque_t* deque, uint32_t capacity)
+{
+    uint32_t size = 1;
+
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    deque->items = calloc(size, sizeof(deque->items[0]));
+    deque->mask = size - 1;
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+}
+
+/** Owner only, a device is in one deque at a time so the capacity suffices */
+static void SIM__push(SIM__deque_t* deque, uint32_t device)
+{
+    int64_t const bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+
+    atomic_store_explicit(&deque->items[bottom & deque->mask], device, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+}
+
+/** Owner only, last pushed first */
+static uint32_t SIM__take(SIM__deque_t* deque)
+{
+    int64_t const bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    uint32_t device = SIM__EMPTY;
+
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top <= bottom)
+    {
+        device = atomic_load_explicit(&deque->items[bottom & deque->mask], memory_order_relaxed);
+        if (top == bottom)
+        {
+            /* The last one, a thief may race for it */
+            if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+            {
+                device = SIM__EMPTY;
+            }
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return device;
+}
+
+/** Any worker, first pushed first */
+static uint32_t SIM__steal(SIM__deque_t* deque)
+{
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t const bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top < bottom)
+    {
+        uint32_t const device = atomic_load_explicit(&deque->items[top & deque->mask], memory_order_relaxed);
+        if (atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                    memory_order_seq_cst, memory_order_relaxed))
+        {
+            return device;
+        }
+    }
+    return SIM__EMPTY;
+}
+
+/** Resumes a device for one slice, FALSE once it reached the end */
+static boolean_t SIM__resume(uint32_t d)
+{
+    BOARD_t* board = &SIM__boards[d];
+    uint64_t const left = SIM__endMs - board->counter.elapsed;
+
+    (void)BOARD_RunFleet(board, 1, (left < SIM__SLICE_MS) ? (uint32_t)left : SIM__SLICE_MS);
+
+    return (board->counter.elapsed < SIM__endMs) ? TRUE : FALSE;
+}
+
+static void* SIM__work(void* argument)
+{
+    SIM__worker_t* self = (SIM__worker_t*)argument;
+
+    while (atomic_load_explicit(&SIM__finished, memory_order_acquire) < SIM__deviceCount)
+    {
+        uint32_t d = SIM__take(&self->deque);
+
+        if ((d == SIM__EMPTY) && (SIM__workerCount > 1))
+        {
+            uint32_t victim = 0;
+            (void)PRNG_Draw(&self->victims, SIM__workerCount - 1, &victim);
+            victim += (victim >= self->id) ? 1 : 0;
+            d = SIM__steal(&SIM__workers[victim].deque);
+            self->steals += (d != SIM__EMPTY) ? 1 : 0;
+        }
+        if (d == SIM__EMPTY)
+        {
+            sched_yield();
+            continue;
+        }
+
+        ++self->resumes;
+        if (SIM__resume(d) == TRUE)
+        {
+            SIM__push(&self->deque, d);
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&SIM__finished, 1, memory_order_release);
+        }
+    }
+    return NULL;
+}
+
+/*****************************************************************************/
+/* Runs                                                                      */
+/*****************************************************************************/
+
+static double SIM__lockstep(void)
+{
+    unsigned long long const start = UNIT_Nanoseconds();
+
+    (void)BOARD_RunFleet(SIM__boards, (uint16_t)SIM__deviceCount, (uint32_t)SIM__endMs);
+
+    return (UNIT_Nanoseconds() - start) * 1e-9;
+}
+
+static double SIM__pool(void)
+{
+    atomic_store(&SIM__finished, 0);
+    for (uint32_t w = 0; w < SIM__workerCount; ++w)
+    {
+        SIM__workers[w].id = w;
+        SIM__workers[w].resumes = 0;
+        SIM__workers[w].steals = 0;
+        SIM__dequeCreate(&SIM__workers[w].deque, SIM__deviceCount);
+        (void)PRNG_Create(&SIM__workers[w].victims, w);
+    }
+    /* Dealt round robin, stealing evens out what the slices cost */
+    for (uint32_t d = 0; d < SIM__deviceCount; ++d)
+    {
+        SIM__push(&SIM__workers[d % SIM__workerCount].deque, d);
+    }
+
+    unsigned long long const start = UNIT_Nanoseconds();
+    for (uint32_t w = 0; w < SIM__workerCount; ++w)
+    {
+        UNIT_CHECK(pthread_create(&SIM__workers[w].thread, NULL, SIM__work, &SIM__workers[w]) == 0);
+    }
+    for (uint32_t w = 0; w < SIM__workerCount; ++w)
+    {
+        UNIT_CHECK(pthread_join(SIM__workers[w].thread, NULL) == 0);
+    }
+    double const seconds = (UNIT_Nanoseconds() - start) * 1e-9;
+
+    for (uint32_t w = 0; w < SIM__workerCount; ++w)
+    {
+        free((void*)SIM__workers[w].deque.items);
+    }
+    return seconds;
+}
+
+int main(int argc, char* argv[])
+{
+    long const cores = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t const seconds = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : SIM__SECONDS;
+
+    SIM__deviceCount = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : SIM__DEVICES;
+    long const workers = (argc > 3) ? strtol(argv[3], NULL, 10) : cores;
+    SIM__workerCount = (workers < 1) ? 1 : ((workers > (long)SIM__WORKERS_MAX) ? SIM__WORKERS_MAX : (uint32_t)workers);
+    SIM__endMs = (uint64_t)seconds * 1000u;
+
+    UNIT_CHECK((SIM__deviceCount > 0) && (SIM__deviceCount <= 0xFFFFu));
+    UNIT_CHECK(seconds > 0);
+    if ((SIM__deviceCount == 0) || (SIM__deviceCount > 0xFFFFu) || (seconds == 0))
+    {
+        return UNIT_RESULT();
+    }
+
+    SIM__boards = calloc(SIM__deviceCount, sizeof(BOARD_t));
+    SIM__devices = calloc(SIM__deviceCount, sizeof(SIM__device_t));
+    SIM__device_t* reference = calloc(SIM__deviceCount, sizeof(SIM__device_t));
+
+    /* Reference: one thread, all boards in lockstep */
+    SIM__setup();
+    double const lockstep = SIM__lockstep();
+    memcpy(reference, SIM__devices, SIM__deviceCount * sizeof(SIM__device_t));
+
+    /* The same fleet on the pool */
+    SIM__setup();
+    double const pool = SIM__pool();
+
+    boolean_t same = TRUE;
+    boolean_t ended = TRUE;
+    uint64_t bytes = 0;
+    uint64_t games = 0;
+    for (uint32_t d = 0; d < SIM__deviceCount; ++d)
+    {
+        const SIM__device_t* device = &SIM__devices[d];
+
+        same = ((device->uartHash == reference[d].uartHash) && (device->uartBytes == reference[d].uartBytes) &&
+                (device->games == reference[d].games)) ? same : FALSE;
+        ended = (SIM__boards[d].counter.elapsed == SIM__endMs) ? ended : FALSE;
+        bytes += device->uartBytes;
+        games += device->games;
+    }
+    UNIT_CHECK(same == TRUE);
+    UNIT_CHECK(ended == TRUE);
+    UNIT_CHECK(games > 0);
+
+    uint64_t resumes = 0;
+    uint64_t steals = 0;
+    for (uint32_t w = 0; w < SIM__workerCount; ++w)
+    {
+        resumes += SIM__workers[w].resumes;
+        steals += SIM__workers[w].steals;
+    }
+
+    double const deviceSeconds = (double)SIM__deviceCount * seconds;
+    printf("%u devices, %u s virtual time, %u workers, %llu games, UART %.1f bytes per device-second\n",
+           SIM__deviceCount, seconds, SIM__workerCount, (unsigned long long)games, bytes / deviceSeconds);
+    printf("device-seconds per wall-second: lockstep %.0f, pool %.0f (%llu resumes, %llu steals)\n",
+           deviceSeconds / lockstep, deviceSeconds / pool, (unsigned long long)resumes, (unsigned long long)steals);
+
+    free(reference);
+    free(SIM__devices);
+    free(SIM__boards);
+    return UNIT_RESULT();
+}
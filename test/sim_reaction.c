@@ -0,0 +1,465 @@
+/**
+* \file sim_reaction.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host Monte Carlo simulation of the reaction game parameters
+*
+* The game logic of reactionGame.c plays millions of games against simulated
+* players, for the parameter set of reactionGame_cfg.h and for neighbours
+* of it which change one parameter. A player reacts after an ex-Gaussian
+* time, presses the wrong side now and then and sometimes bets on the
+* moment the digit appears. Per parameter set the tool reports what the
+* parameters trade against each other:
+* - game length, which grows with the rounds and the delay,
+* - timeouts, which a short round causes for slow players,
+* - anticipated scores, presses the player fired before seeing the digit,
+*   which a predictable delay makes frequent,
+* - the spread of the score and how often a player 50 ms faster on average
+*   wins against the typical one, which more rounds make more reliable.
+*
+* The game keeps its generator in prng.c, so the workers are processes, one
+* per core, each with its own game and player generator. They claim games
+* in chunks and add their tallies to shared counters with atomic adds, no
+* lock is taken. The player figures are assumptions of the usual order for
+* two-choice reaction tasks, not measurements.
+*
+* make -C test sim, or build/sim_reaction [games per parameter set]
+*/
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "unit.h"
+#include "project.h"
+/* Before the bsw headers, which would find the real one next to them */
+#include "cycle.h"
+#include "../source/asw/reactionGame.c"
+#include "../source/bsw/stats.c"
+#include "../source/bsw/prng.c"
+#include "../source/bsw/fmt.c"
+
+/*****************************************************************************/
+/* Parameters of the simulation                                              */
+/*****************************************************************************/
+
+#define SIM__GAMES          1000000u    /**< Default games per parameter set and player */
+#define SIM__CHUNK          1024u       /**< Games a worker claims at once */
+#define SIM__SEED           0x5EED0000u /**< Seed of the first worker */
+#define SIM__ANTICIPATION   0.2         /**< Share of rounds the player bets on the delay */
+#define SIM__LEAD_MS        100.0       /**< Press of a bet after the expected digit [ms] */
+#define SIM__HUMAN_MIN_MS   150u        /**< Faster correct presses are taken as anticipated [ms] */
+#define SIM__NEXT_ROUND_MS  500.0       /**< Press which starts the next round [ms] */
+#define SIM__BIN_MS         10u         /**< Width of a score histogram bin [ms] */
+#define SIM__BINS           201u        /**< Score bins up to a 2 s round */
+#define SIM__FAST_WINS_MIN  0.75        /**< Ranking the faster player must reach at the cfg set */
+
+/** Reaction time mu + sigma * N(0, 1) + tau * Exp(1) and wrong side */
+typedef struct {
+    double mu;              /**< Mean of the normal part [ms] */
+    double sigma;           /**< Deviation of the normal part [ms] */
+    double tau;             /**< Mean of the exponential tail [ms] */
+    double errors;          /**< Share of presses on the wrong side */
+} SIM__player_t;
+
+typedef enum {
+    SIM__TYPICAL = 0,
+    SIM__FAST,
+    SIM__SLOW,
+    SIM__PLAYERS
+} SIM__playerId_t;
+
+static const SIM__player_t SIM__player[SIM__PLAYERS] = {
+    {340.0, 40.0, 100.0, 0.04},
+    {290.0, 40.0, 100.0, 0.04},  /**< The typical player 50 ms earlier */
+    {420.0, 60.0, 160.0, 0.06}
+};
+
+typedef struct {
+    uint8_t rounds;
+    uint8_t durationSec;
+    uint8_t delayMaxSec;
+} SIM__config_t;
+
+/** The cfg set first, then one parameter changed at a time */
+static const SIM__config_t SIM__config[] = {
+    {REACTION_MAX_ROUNDS, REACTION_ROUND_DURATION_SEC, REACTION_DELAY_MAX_SEC},
+    {5,  1, 3},
+    {20, 1, 3},
+    {10, 2, 3},
+    {10, 1, 1},
+    {10, 1, 2},
+    {10, 1, 5}
+};
+
+#define SIM__CONFIGS    (sizeof(SIM__config) / sizeof(SIM__config[0]))
+
+/** Tally of one parameter set, per worker and shared */
+typedef struct {
+    uint64_t games;
+    uint64_t rounds[SIM__PLAYERS];
+    uint64_t correct[SIM__PLAYERS];
+    uint64_t wrong[SIM__PLAYERS];
+    uint64_t timeouts[SIM__PLAYERS];
+    uint64_t anticipated[SIM__PLAYERS];
+    uint64_t lengthMs[SIM__PLAYERS];
+    uint64_t fastWins;              /**< Twice the games the fast player won, ties count once */
+    uint64_t scores[SIM__BINS];     /**< Scores of the typical player */
+} SIM__tally_t;
+
+typedef struct {
+    _Atomic uint64_t next[SIM__CONFIGS];            /**< Next unclaimed game */
+    _Atomic uint64_t tally[SIM__CONFIGS][sizeof(SIM__tally_t) / sizeof(uint64_t)];
+} SIM__shared_t;
+
+/*****************************************************************************/
+/* Board stubs, the game only sees the display and the round start           */
+/*****************************************************************************/
+
+uint32_t CYCLE_hostNow;
+static sint8_t SIM__display[2];
+
+RC_t CYCLE_Init(void)
+{
+    return RC_SUCCESS;
+}
+
+void UART_Logs_Start(void)
+{
+}
+
+void UART_Logs_PutString(const char8 string[])
+{
+    (void)string;
+}
+
+RC_t SEVEN_Init()
+{
+    SIM__display[SEVEN_0] = 0;
+    SIM__display[SEVEN_1] = 0;
+    return RC_SUCCESS;
+}
+
+RC_t SEVEN_Set(SEVEN_id_t sevenId, uint8_t value)
+{
+    SIM__display[sevenId] = (sint8_t)value;
+    return RC_SUCCESS;
+}
+
+RC_t SEVEN_Get(SEVEN_id_t sevenId, sint8_t* value)
+{
+    *value = SIM__display[sevenId];
+    return RC_SUCCESS;
+}
+
+RC_t SWTIMER_Create(SWTIMER_t* timer, SWTIMER_callback_t callback, void* context)
+{
+    (void)timer;
+    (void)callback;
+    (void)context;
+    return RC_SUCCESS;
+}
+
+RC_t SWTIMER_Start(SWTIMER_t* timer, uint32_t delayMs, uint32_t periodMs)
+{
+    (void)timer;
+    (void)delayMs;
+    (void)periodMs;
+    return RC_SUCCESS;
+}
+
+RC_t SWTIMER_Cancel(SWTIMER_t* timer)
+{
+    (void)timer;
+    return RC_SUCCESS;
+}
+
+RC_t CAPTURE_StartRound(TIMEBASE_time_t start)
+{
+    (void)start;
+    return RC_SUCCESS;
+}
+
+TIMEBASE_time_t TIMEBASE_Now(void)
+{
+    return 0;
+}
+
+RC_t REPLAY_Value(REPLAY_kind_t kind, uint32_t* value)
+{
+    (void)kind;
+    (void)value;
+    return RC_SUCCESS;
+}
+
+/*****************************************************************************/
+/* Player model                                                              */
+/*****************************************************************************/
+
+/** Uniform in (0, 1) */
+static double SIM__uniform(PRNG_t* rng)
+{
+    uint32_t value = 0;
+    (void)PRNG_Draw(rng, 0xFFFFFFFFu, &value);
+    return (value + 0.5) / 4294967296.0;
+}
+
+static double SIM__reactionMs(const SIM__player_t* player, PRNG_t* rng)
+{
+    double const normal = sqrt(-2.0 * log(SIM__uniform(rng))) * cos(2.0 * M_PI * SIM__uniform(rng));
+    double const ms = player->mu + player->sigma * normal - player->tau * log(SIM__uniform(rng));
+
+    return (ms > 0.0) ? ms : 0.0;
+}
+
+/** Button of the side which answers digit */
+static uint8_t SIM__buttons(uint16_t digit)
+{
+    return (digit == 1) ? CAPTURE_BUTTON_MASK(Button_Right_1) : CAPTURE_BUTTON_MASK(Button_Left_1);
+}
+
+/*****************************************************************************/
+/* Game                                                                      */
+/*****************************************************************************/
+
+/**
+ * One round as RG__startRound(), RG__showDigit() and RG__evaluatePress() or
+ * RG__timeout() play it. A bet which falls before the digit is dropped like
+ * RG__dropPresses() does, the player then reacts to the digit.
+ */
+static void SIM__round(Game_t* game, uint8_t delayMaxSec, SIM__playerId_t id, PRNG_t* rng, SIM__tally_t* tally)
+{
+    const SIM__player_t* player = &SIM__player[id];
+    double const roundMs = game->durationOfRoundSec * 1000.0;
+    uint16_t delay = 0;
+    uint16_t digit = 0;
+
+    (void)REACTION_generateRandomNum(&delay, delayMaxSec);
+    (void)REACTION_generateRandomNum(&digit, 2);
+    (void)REACTION_setDisplay(digit);
+    (void)REACTION_startRoundTimer(game);
+
+    double pressMs = SIM__reactionMs(player, rng);
+    uint8_t buttons = SIM__buttons((SIM__uniform(rng) < player->errors) ? 3 - digit : digit);
+
+    if (SIM__uniform(rng) < SIM__ANTICIPATION)
+    {
+        uint32_t bet = 0;
+        (void)PRNG_Draw(rng, delayMaxSec, &bet);
+        double const early = ((double)bet + 1.0 - delay) * 1000.0 + SIM__LEAD_MS;
+        if ((early >= 0.0) && (early < pressMs))
+        {
+            pressMs = early;
+            buttons = SIM__buttons((SIM__uniform(rng) < 0.5) ? 1 : 2);
+        }
+    }
+
+    tally->lengthMs[id] += (uint64_t)(delay * 1000.0 + fmin(pressMs, roundMs) + SIM__NEXT_ROUND_MS);
+    (void)REACTION_stopRoundTimer(game);
+
+    if (pressMs >= roundMs)
+    {
+        ++tally->timeouts[id];
+    }
+    else if (REACTION_correctButtonPressed(buttons) == TRUE)
+    {
+        uint16_t reaction = 0;
+        (void)REACTION_getReactionTimeMS(&reaction, game, (uint16_t)pressMs);
+        (void)STATS_Add(&game->reactionTimes, reaction);
+        ++tally->correct[id];
+        tally->anticipated[id] += (reaction < SIM__HUMAN_MIN_MS) ? 1 : 0;
+    }
+    else
+    {
+        ++tally->wrong[id];
+    }
+    (void)REACTION_resetDisplay();
+
+    ++tally->rounds[id];
+    ++game->roundNumber;
+}
+
+/** Plays a game, the score is the mean reaction time or the round duration without one */
+static uint16_t SIM__game(Game_t* game, const SIM__config_t* config, SIM__playerId_t id, PRNG_t* rng,
+                          SIM__tally_t* tally)
+{
+    STATS_summary_t summary = {0};
+
+    (void)REACTION_resetGame(game);
+    game->maxRounds = config->rounds;
+    game->durationOfRoundSec = config->durationSec;
+
+    while (game->roundNumber <= game->maxRounds)
+    {
+        SIM__round(game, config->delayMaxSec, id, rng, tally);
+    }
+
+    if (STATS_GetSummary(&game->reactionTimes, &summary) != RC_SUCCESS)
+    {
+        return (uint16_t)(config->durationSec * 1000u);
+    }
+    return summary.mean;
+}
+
+/*****************************************************************************/
+/* Workers                                                                   */
+/*****************************************************************************/
+
+static void SIM__flush(SIM__shared_t* shared, uint8_t c, SIM__tally_t* tally)
+{
+    const uint64_t* local = (const uint64_t*)tally;
+
+    for (size_t i = 0; i < sizeof(SIM__tally_t) / sizeof(uint64_t); ++i)
+    {
+        if (local[i] != 0)
+        {
+            atomic_fetch_add_explicit(&shared->tally[c][i], local[i], memory_order_relaxed);
+        }
+    }
+    memset(tally, 0, sizeof(*tally));
+}
+
+static void SIM__worker(SIM__shared_t* shared, uint32_t seed, uint64_t games)
+{
+    static Game_t game;
+    static SIM__tally_t tally;
+    PRNG_t rng;
+
+    /* The game seeds its generator from the cycle counter */
+    CYCLE_hostNow = seed;
+    (void)REACTION_init(&game, NULL);
+    (void)PRNG_Create(&rng, ~seed);
+
+    for (uint8_t c = 0; c < SIM__CONFIGS; ++c)
+    {
+        uint64_t first;
+
+        while ((first = atomic_fetch_add_explicit(&shared->next[c], SIM__CHUNK, memory_order_relaxed)) < games)
+        {
+            uint64_t const last = (first + SIM__CHUNK < games) ? first + SIM__CHUNK : games;
+
+            for (uint64_t g = first; g < last; ++g)
+            {
+                uint16_t const typical = SIM__game(&game, &SIM__config[c], SIM__TYPICAL, &rng, &tally);
+                uint16_t const fast = SIM__game(&game, &SIM__config[c], SIM__FAST, &rng, &tally);
+                (void)SIM__game(&game, &SIM__config[c], SIM__SLOW, &rng, &tally);
+
+                tally.fastWins += (fast < typical) ? 2 : ((fast == typical) ? 1 : 0);
+                ++tally.scores[(typical / SIM__BIN_MS < SIM__BINS) ? typical / SIM__BIN_MS : SIM__BINS - 1];
+                ++tally.games;
+            }
+            SIM__flush(shared, c, &tally);
+        }
+    }
+}
+
+/*****************************************************************************/
+/* Report                                                                    */
+/*****************************************************************************/
+
+/** Upper bound of the bin the share lies in, as the STATS percentiles */
+static uint32_t SIM__percentile(const SIM__tally_t* tally, double share)
+{
+    uint64_t const rank = (uint64_t)ceil(share * tally->games);
+    uint64_t seen = 0;
+
+    for (uint32_t i = 0; i < SIM__BINS; ++i)
+    {
+        seen += tally->scores[i];
+        if ((seen >= rank) && (seen > 0))
+        {
+            return (i + 1) * SIM__BIN_MS;
+        }
+    }
+    return SIM__BINS * SIM__BIN_MS;
+}
+
+static double SIM__percent(uint64_t part, uint64_t whole)
+{
+    return (whole > 0) ? 100.0 * part / whole : 0.0;
+}
+
+/** Prints a parameter set, returns how often the fast player won */
+static double SIM__report(uint8_t c, const SIM__tally_t* tally)
+{
+    const SIM__config_t* config = &SIM__config[c];
+    double const fastWins = (tally->games > 0) ? tally->fastWins / (2.0 * tally->games) : 0.0;
+
+    printf("%c %6u %4u %5u | %6.1f | %5.2f %5.2f | %5.2f | %5.2f | %4u %4u %4u | %5.1f\n",
+           (c == 0) ? '*' : ' ', config->rounds, config->durationSec, config->delayMaxSec,
+           tally->lengthMs[SIM__TYPICAL] / (1000.0 * tally->games),
+           SIM__percent(tally->timeouts[SIM__TYPICAL], tally->rounds[SIM__TYPICAL]),
+           SIM__percent(tally->timeouts[SIM__SLOW], tally->rounds[SIM__SLOW]),
+           SIM__percent(tally->wrong[SIM__TYPICAL], tally->rounds[SIM__TYPICAL]),
+           SIM__percent(tally->anticipated[SIM__TYPICAL], tally->correct[SIM__TYPICAL]),
+           SIM__percentile(tally, 0.1), SIM__percentile(tally, 0.5), SIM__percentile(tally, 0.9),
+           100.0 * fastWins);
+
+    return fastWins;
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t const games = (argc > 1) ? strtoull(argv[1], NULL, 10) : SIM__GAMES;
+    long const workers = (sysconf(_SC_NPROCESSORS_ONLN) > 0) ? sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    SIM__shared_t* shared = mmap(NULL, sizeof(SIM__shared_t), PROT_READ | PROT_WRITE,
+                                 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    UNIT_CHECK(shared != MAP_FAILED);
+    UNIT_CHECK(games > 0);
+    if ((shared == MAP_FAILED) || (games == 0))
+    {
+        return UNIT_RESULT();
+    }
+
+    unsigned long long const start = UNIT_Nanoseconds();
+    for (long w = 0; w < workers; ++w)
+    {
+        pid_t const pid = fork();
+        if (pid == 0)
+        {
+            SIM__worker(shared, SIM__SEED + (uint32_t)w, games);
+            _exit(0);
+        }
+        UNIT_CHECK(pid > 0);
+    }
+    for (long w = 0; w < workers; ++w)
+    {
+        int status = 0;
+        UNIT_CHECK((wait(&status) > 0) && WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+    }
+    double const seconds = (UNIT_Nanoseconds() - start) * 1e-9;
+
+    printf("%llu games per set and player, %ld workers\n", (unsigned long long)games, workers);
+    printf("  rounds  dur delay | game s | timeout %%  | wrong | antic | score p10/p50/p90 | fast\n");
+    printf("                    |        | typ   slow |   %%   |   %%   |       [ms]        | wins %%\n");
+
+    uint64_t played = 0;
+    for (uint8_t c = 0; c < SIM__CONFIGS; ++c)
+    {
+        SIM__tally_t tally;
+        uint64_t* local = (uint64_t*)&tally;
+
+        for (size_t i = 0; i < sizeof(SIM__tally_t) / sizeof(uint64_t); ++i)
+        {
+            local[i] = atomic_load(&shared->tally[c][i]);
+        }
+        UNIT_CHECK(tally.games == games);
+        played += tally.games * SIM__PLAYERS;
+
+        double const fastWins = SIM__report(c, &tally);
+        if (c == 0)
+        {
+            /* The cfg set ranks the faster player and rarely times out a typical one */
+            UNIT_CHECK(fastWins >= SIM__FAST_WINS_MIN);
+            UNIT_CHECK(SIM__percent(tally.timeouts[SIM__TYPICAL], tally.rounds[SIM__TYPICAL]) < 1.0);
+        }
+    }
+    printf("* reactionGame_cfg.h, %.0f games/s\n", played / seconds);
+
+    (void)munmap(shared, sizeof(SIM__shared_t));
+    return UNIT_RESULT();
+}
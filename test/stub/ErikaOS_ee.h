@@ -0,0 +1,30 @@
+/**
+* \file ErikaOS_ee.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host replacement of the ERIKA OS API for the module tests
+*
+* Declares the kernel types and services used by the modules under test.
+* Each test defines the services it needs and records their calls.
+*/
+
+#ifndef ERIKAOS_EE_H
+#define ERIKAOS_EE_H
+
+typedef int             TaskType;           /**< Task identifier */
+typedef unsigned int    EventMaskType;      /**< Event mask of an extended task */
+typedef unsigned char   StatusType;         /**< Result of a kernel service */
+typedef TaskType*       TaskRefType;        /**< Reference to a task identifier */
+
+#define E_OK            ((StatusType)0)     /**< Service succeeded */
+#define INVALID_TASK    ((TaskType)-1)      /**< No task is running */
+
+StatusType SetEvent(TaskType task, EventMaskType mask);
+StatusType GetTaskID(TaskRefType task);
+void SuspendAllInterrupts(void);
+void ResumeAllInterrupts(void);
+void SuspendOSInterrupts(void);
+void ResumeOSInterrupts(void);
+
+#endif /* ERIKAOS_EE_H */
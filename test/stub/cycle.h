@@ -0,0 +1,24 @@
+/**
+* \file cycle.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host replacement of the DWT cycle counter for the module tests
+*
+* CYCLE_NOW() reads a variable the test advances, so execution times are
+* exactly those the test simulates.
+*/
+
+#ifndef CYCLE_H
+#define CYCLE_H
+
+#include "global.h"
+
+#define CYCLE_NOW()         (CYCLE_hostNow)
+#define CYCLE_SINCE(start)  ((uint32_t)(CYCLE_NOW() - (uint32_t)(start)))
+
+extern uint32_t CYCLE_hostNow;  /**< Simulated cycle counter, defined by the test */
+
+RC_t CYCLE_Init(void);
+
+#endif /* CYCLE_H */
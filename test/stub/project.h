@@ -0,0 +1,21 @@
+/**
+* \file project.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host replacement of the generated project.h for the module tests
+*
+* Only the register level declarations of the generated sources, the log
+* UART and the replaced ERIKA OS API are taken, the functions a test needs
+* are defined by the test itself.
+*/
+
+#ifndef PROJECT_H
+#define PROJECT_H
+
+#include "cytypes.h"
+#include "CyDmac.h"
+#include "ErikaOS_ee.h"
+#include "UART_Logs.h"
+
+#endif /* PROJECT_H */
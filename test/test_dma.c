@@ -0,0 +1,267 @@
+/**
+* \file test_dma.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test of the DMA service layer
+*
+* The CyDmac functions are replaced by a model of the TD pool and the
+* channel registers, so the chains built by dma.c can be inspected.
+*/
+
+#include "unit.h"
+#include "../source/bsw/dma.c"
+
+/*****************************************************************************/
+/* CyDmac and kernel model                                                   */
+/*****************************************************************************/
+
+#define TEST__TDS       6       /**< TDs in the modelled pool */
+#define TEST__CHANNEL   3       /**< Hardware channel used by the tests */
+#define TEST__TERMOUT0  5       /**< Line numbers as a fitter would assign them */
+#define TEST__TERMOUT1  9
+#define TEST__TERMIN    12
+
+static struct {
+    boolean_t free;
+    uint16_t  count;
+    uint8_t   next;
+    uint8_t   config;
+    uint16_t  src;
+    uint16_t  dst;
+} TEST__td[TEST__TDS];
+
+static struct {
+    uint8_t   burstCount;
+    uint8_t   requestPerBurst;
+    uint8_t   tdDone0;
+    uint8_t   tdDone1;
+    uint8_t   tdStop;
+    uint8_t   initialTd;
+    boolean_t enabled;
+} TEST__ch;
+
+static unsigned int TEST__events;
+
+uint8 CyDmaTdAllocate(void)
+{
+    for (uint8_t i = 0; i < TEST__TDS; ++i)
+    {
+        if (TEST__td[i].free == TRUE)
+        {
+            TEST__td[i].free = FALSE;
+            return i;
+        }
+    }
+    return CY_DMA_INVALID_TD;
+}
+
+void CyDmaTdFree(uint8 tdHandle)
+{
+    TEST__td[tdHandle].free = TRUE;
+}
+
+uint8 CyDmaTdFreeCount(void)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < TEST__TDS; ++i)
+    {
+        count += (TEST__td[i].free == TRUE) ? 1 : 0;
+    }
+    return count;
+}
+
+cystatus CyDmaTdSetConfiguration(uint8 tdHandle, uint16 transferCount, uint8 nextTd, uint8 configuration)
+{
+    TEST__td[tdHandle].count = transferCount;
+    TEST__td[tdHandle].next = nextTd;
+    TEST__td[tdHandle].config = configuration;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaTdSetAddress(uint8 tdHandle, uint16 source, uint16 destination)
+{
+    TEST__td[tdHandle].src = source;
+    TEST__td[tdHandle].dst = destination;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetConfiguration(uint8 chHandle, uint8 burstCount, uint8 requestPerBurst, uint8 tdDone0,
+                                 uint8 tdDone1, uint8 tdStop)
+{
+    (void)chHandle;
+    TEST__ch.burstCount = burstCount;
+    TEST__ch.requestPerBurst = requestPerBurst;
+    TEST__ch.tdDone0 = tdDone0;
+    TEST__ch.tdDone1 = tdDone1;
+    TEST__ch.tdStop = tdStop;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetExtendedAddress(uint8 chHandle, uint16 source, uint16 destination)
+{
+    (void)chHandle; (void)source; (void)destination;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetInitialTd(uint8 chHandle, uint8 startTd)
+{
+    (void)chHandle;
+    TEST__ch.initialTd = startTd;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChEnable(uint8 chHandle, uint8 preserveTds)
+{
+    (void)chHandle; (void)preserveTds;
+    TEST__ch.enabled = TRUE;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChDisable(uint8 chHandle)
+{
+    (void)chHandle;
+    TEST__ch.enabled = FALSE;
+    return CYRET_SUCCESS;
+}
+
+StatusType SetEvent(TaskType task, EventMaskType mask)
+{
+    (void)task; (void)mask;
+    ++TEST__events;
+    return E_OK;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static const DMA_config_t TEST__config = {
+    TEST__CHANNEL, 4, 1, 3, 0, 0, TEST__TERMOUT0, TEST__TERMOUT1, TEST__TERMIN
+};
+
+static void TEST__open(void)
+{
+    DMA_handle_t handle;
+    DMA_config_t bad = TEST__config;
+
+    UNIT_CHECK(DMA_Open(NULL, &handle) == RC_ERROR_BAD_PARAM);
+    bad.tdCount = 0;
+    UNIT_CHECK(DMA_Open(&bad, &handle) == RC_ERROR_BAD_PARAM);
+    bad.tdCount = DMA_MAX_TD_PER_CHANNEL + 1;
+    UNIT_CHECK(DMA_Open(&bad, &handle) == RC_ERROR_BAD_PARAM);
+
+    /* The trigger lines of the configuration reach the channel */
+    UNIT_CHECK(DMA_Open(&TEST__config, &handle) == RC_SUCCESS);
+    UNIT_CHECK(TEST__ch.tdDone0 == TEST__TERMOUT0);
+    UNIT_CHECK(TEST__ch.tdDone1 == TEST__TERMOUT1);
+    UNIT_CHECK(TEST__ch.tdStop == TEST__TERMIN);
+    UNIT_CHECK(TEST__ch.burstCount == 4);
+    UNIT_CHECK(CyDmaTdFreeCount() == TEST__TDS - 3);
+
+    /* Not enough TDs left for a second channel of the same size */
+    DMA_handle_t second;
+    UNIT_CHECK(DMA_Open(&TEST__config, &second) == RC_SUCCESS);
+    DMA_handle_t third;
+    UNIT_CHECK(DMA_Open(&TEST__config, &third) == RC_ERROR_MEMORY);
+    UNIT_CHECK(third == DMA_INVALID_HANDLE);
+
+    UNIT_CHECK(DMA_Close(second) == RC_SUCCESS);
+    UNIT_CHECK(DMA_Close(handle) == RC_SUCCESS);
+    UNIT_CHECK(DMA_Close(handle) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(CyDmaTdFreeCount() == TEST__TDS);
+}
+
+static void TEST__single(void)
+{
+    static uint8_t src[8];
+    static uint8_t dst[8];
+    DMA_handle_t handle;
+
+    UNIT_CHECK(DMA_Open(&TEST__config, &handle) == RC_SUCCESS);
+    DMA__channel_t* ch = &DMA__channels[handle];
+
+    UNIT_CHECK(DMA_Start(handle) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(DMA_ChainFinish(handle, DMA_CHAIN_SINGLE) == RC_ERROR_BUFFER_EMTPY);
+    UNIT_CHECK(DMA_ChainAdd(handle, src, dst, 0, TD_INC_SRC_ADR) == RC_ERROR_BAD_PARAM);
+
+    UNIT_CHECK(DMA_ChainAdd(handle, src, dst, 4, TD_INC_SRC_ADR | TD_INC_DST_ADR) == RC_SUCCESS);
+    UNIT_CHECK(DMA_ChainAdd(handle, &src[4], &dst[4], 4, TD_INC_SRC_ADR | TD_TERMOUT0_EN) == RC_SUCCESS);
+    UNIT_CHECK(DMA_ChainAdd(handle, src, dst, 1, 0) == RC_SUCCESS);
+    UNIT_CHECK(DMA_ChainAdd(handle, src, dst, 1, 0) == RC_ERROR_BUFFER_FULL);
+    UNIT_CHECK(DMA_ChainFinish(handle, DMA_CHAIN_SINGLE) == RC_SUCCESS);
+
+    /* td[0] -> td[1] -> td[2] -> end, flags and lengths kept while linking */
+    UNIT_CHECK(TEST__ch.initialTd == ch->td[0]);
+    UNIT_CHECK(TEST__td[ch->td[0]].next == ch->td[1]);
+    UNIT_CHECK(TEST__td[ch->td[1]].next == ch->td[2]);
+    UNIT_CHECK(TEST__td[ch->td[2]].next == CY_DMA_DISABLE_TD);
+    UNIT_CHECK(TEST__td[ch->td[1]].config == (TD_INC_SRC_ADR | TD_TERMOUT0_EN));
+    UNIT_CHECK(TEST__td[ch->td[1]].count == 4);
+    UNIT_CHECK(TEST__td[ch->td[1]].src == LO16((uintptr_t)&src[4]));
+
+    /* A single chain stops itself after the last TD */
+    UNIT_CHECK(DMA_Start(handle) == RC_SUCCESS);
+    UNIT_CHECK(TEST__ch.enabled == TRUE);
+    UNIT_CHECK(DMA_ChainFinish(handle, DMA_CHAIN_SINGLE) == RC_ERROR_BUSY);
+    UNIT_CHECK(DMA_NotifyComplete(handle) == RC_SUCCESS);
+    UNIT_CHECK(ch->running == FALSE);
+    UNIT_CHECK(DMA_ChainReset(handle) == RC_SUCCESS);
+
+    UNIT_CHECK(DMA_Close(handle) == RC_SUCCESS);
+}
+
+static void TEST__pingPong(void)
+{
+    static uint8_t reg;
+    static uint8_t ping[16];
+    static uint8_t pong[16];
+    DMA_handle_t handle;
+    DMA_buffer_t buffer;
+
+    UNIT_CHECK(DMA_Open(&TEST__config, &handle) == RC_SUCCESS);
+    DMA__channel_t* ch = &DMA__channels[handle];
+
+    UNIT_CHECK(DMA_PingPong(handle, &reg, ping, pong, sizeof(ping), TD_INC_DST_ADR) == RC_SUCCESS);
+    UNIT_CHECK(TEST__td[ch->td[1]].next == ch->td[0]);
+    UNIT_CHECK((TEST__td[ch->td[0]].config & TD_TERMOUT0_EN) != 0);
+    UNIT_CHECK(DMA_SetCompletionEvent(handle, 1, 0x01) == RC_SUCCESS);
+
+    UNIT_CHECK(DMA_Start(handle) == RC_SUCCESS);
+    UNIT_CHECK(DMA_GetReadyBuffer(handle, &buffer) == RC_ERROR_BUFFER_EMTPY);
+
+    /* Halves alternate and the circular chain keeps running */
+    TEST__events = 0;
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        UNIT_CHECK(DMA_NotifyComplete(handle) == RC_SUCCESS);
+        UNIT_CHECK(DMA_GetReadyBuffer(handle, &buffer) == RC_SUCCESS);
+        UNIT_CHECK(buffer == (((i % 2) == 0) ? DMA_BUFFER_PING : DMA_BUFFER_PONG));
+        UNIT_CHECK(ch->running == TRUE);
+    }
+    UNIT_CHECK(TEST__events == 5);
+
+    /* The chain is only changed while the channel is stopped */
+    UNIT_CHECK(DMA_ChainFinish(handle, DMA_CHAIN_CIRCULAR) == RC_ERROR_BUSY);
+    UNIT_CHECK(DMA_ChainReset(handle) == RC_ERROR_BUSY);
+    UNIT_CHECK(DMA_Stop(handle) == RC_SUCCESS);
+    UNIT_CHECK(TEST__ch.enabled == FALSE);
+    UNIT_CHECK(TEST__ch.initialTd == ch->td[0]);
+    UNIT_CHECK(DMA_ChainReset(handle) == RC_SUCCESS);
+
+    UNIT_CHECK(DMA_Close(handle) == RC_SUCCESS);
+}
+
+int main(void)
+{
+    for (uint8_t i = 0; i < TEST__TDS; ++i)
+    {
+        TEST__td[i].free = TRUE;
+    }
+
+    TEST__open();
+    TEST__single();
+    TEST__pingPong();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,337 @@
+/**
+* \file test_exec_budget.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test of the kernel execution budget monitoring
+*
+* The kernel call sites of ee_as_timing_prot.inc are replayed in the order
+* the ISR2 stubs, the dispatcher and TerminateTask() call them, with a
+* simulated DWT counter. Overruns and early arrivals are injected and the
+* statistics read back through GetExecutionBudgetStats(), also while the
+* CPU clock is divided.
+*/
+
+/* The kernel model below replaces ErikaOS_ee_internal.inc */
+#define PKG_EE_INTERNAL_H
+
+#include "unit.h"
+#include "global.h"
+#include "ErikaOS_ee.h"
+
+/*****************************************************************************/
+/* Kernel model                                                              */
+/*****************************************************************************/
+
+typedef uint32_t        EE_UINT32;
+typedef uint64_t        EE_UINT64;
+typedef uint32_t        EE_UREG;
+typedef uint8_t         EE_TYPEBOOL;
+
+#define EE_TRUE         ((EE_TYPEBOOL)1U)
+#define EE_FALSE        ((EE_TYPEBOOL)0U)
+#define EE_NIL          ((TaskType)-1)
+#define EE_MAX_TASK     6
+
+#define __OO_EXTENDED_STATUS__
+#define E_OS_ID             ((StatusType)3)
+#define E_OS_VALUE          ((StatusType)8)
+#define E_OS_PARAM_POINTER  ((StatusType)23)
+
+#define EE_OS_DECLARE_AND_ENTER_CRITICAL_SECTION()  ((void)0)
+#define EE_OS_EXIT_CRITICAL_SECTION()               ((void)0)
+
+#include "budget_cfg.h"
+#include "ErikaOS_ee_as_timing_prot.inc"
+
+#define TEST__REACTIONGAME  2
+#define TEST__FADER         3       /**< 200 us budget, 900 us inter-arrival */
+#define TEST__GLOWER        4       /**< 200 us budget */
+
+#define TEST__US(us)        EE_AS_EB_MICRO_TO_CYCLES(us)
+
+static EE_UINT32 TEST__dwt;         /**< Simulated DWT cycle counter */
+static EE_UREG   TEST__nesting;     /**< ISR2 nesting level */
+
+const EE_as_eb_ROM_type EE_as_eb_ROM[EE_MAX_TASK] = {
+    EE_EXEC_BUDGET_ROM
+};
+
+static void EE_cortex_mx_dwt_start(void)
+{
+    TEST__dwt = 0xFFFF0000u;        /* Wraps during the test */
+}
+
+static EE_UINT32 EE_cortex_mx_dwt_cycles(void)
+{
+    return TEST__dwt;
+}
+
+static EE_UREG EE_hal_get_IRQ_nesting_level(void)
+{
+    return TEST__nesting;
+}
+
+#include "../Generated_Source/PSoC5/ErikaOS_ee_as_exec_budget.c"
+
+/** The running context executes */
+static void TEST__run(EE_UINT32 cycles)
+{
+    TEST__dwt += cycles;
+}
+
+/** ActivateTask() or an alarm releases a job, the dispatcher starts it */
+static void TEST__start(TaskType task)
+{
+    (void)EE_as_tp_handle_interarrival(EE_AS_TP_ID_FROM_TASK(task));
+    EE_as_tp_active_start_on_TASK_stacking(task);
+}
+
+/** TerminateTask(), the dispatcher continues with next (EE_NIL for idle) */
+static void TEST__terminate(TaskType next)
+{
+    EE_as_tp_active_pause_and_update_budgets();
+    EE_as_tp_stop_budget(NULL, EE_EXECUTION_BUDGET);
+    if (next == EE_NIL)
+    {
+        EE_as_tp_active_start_idle();
+    }
+    else
+    {
+        EE_as_tp_active_set_from_TASK(next);
+    }
+}
+
+/** ISR2 prologue as in EE_ISR2_prestub() */
+static void TEST__isrEnter(void)
+{
+    EE_as_tp_active_pause_and_update_budgets();
+    ++TEST__nesting;
+}
+
+/** ISR2 epilogue back to the interrupted task, as EE_ISR2_poststub() */
+static void TEST__isrExit(TaskType current)
+{
+    /* EE_IRQ_end_post_stub() */
+    EE_as_tp_active_reset_budgets();
+    --TEST__nesting;
+    if (TEST__nesting == 0U)
+    {
+        EE_as_tp_active_update_budgets_and_restart();
+        EE_as_tp_active_set_from_TASK(current);
+    }
+}
+
+static EE_as_eb_RAM_type TEST__stats(TaskType task)
+{
+    EE_as_eb_RAM_type stats;
+    UNIT_CHECK(GetExecutionBudgetStats(task, &stats) == E_OK);
+    return stats;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    EE_as_eb_RAM_type stats;
+
+    UNIT_CHECK(GetExecutionBudgetStats(EE_MAX_TASK, &stats) == E_OS_ID);
+    UNIT_CHECK(GetExecutionBudgetStats(-1, &stats) == E_OS_ID);
+    UNIT_CHECK(GetExecutionBudgetStats(TEST__FADER, NULL) == E_OS_PARAM_POINTER);
+}
+
+static void TEST__withinBudget(void)
+{
+    /* 150 us of the fader around a 300 us ISR2, which is not charged */
+    TEST__start(TEST__FADER);
+    TEST__run(TEST__US(100));
+    TEST__isrEnter();
+    TEST__run(TEST__US(150));
+    /* Kernel services of the ISR2 neither charge nor end the job */
+    EE_as_tp_active_pause_and_update_budgets();
+    TEST__run(TEST__US(150));
+    TEST__isrExit(TEST__FADER);
+    TEST__run(TEST__US(50));
+    TEST__terminate(EE_NIL);
+
+    EE_as_eb_RAM_type stats = TEST__stats(TEST__FADER);
+    UNIT_CHECK(stats.jobs == 1);
+    UNIT_CHECK(stats.max_cycles == TEST__US(150));
+    UNIT_CHECK(stats.overruns == 0);
+
+    /* Idle time is charged to nobody */
+    TEST__run(TEST__US(5000));
+    TEST__isrEnter();
+    TEST__isrExit(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).max_cycles == TEST__US(150));
+}
+
+static void TEST__overrun(void)
+{
+    /* Injected 250 us job: detected by the next ISR2 before the job ends */
+    TEST__run(TEST__US(1000));
+    TEST__start(TEST__FADER);
+    TEST__run(TEST__US(250));
+    TEST__isrEnter();
+    UNIT_CHECK(TEST__stats(TEST__FADER).overruns == 1);
+    TEST__isrExit(TEST__FADER);
+
+    /* Later slices of the same job do not count it again */
+    TEST__run(TEST__US(100));
+    TEST__isrEnter();
+    TEST__isrExit(TEST__FADER);
+    TEST__run(TEST__US(10));
+    TEST__terminate(EE_NIL);
+
+    EE_as_eb_RAM_type stats = TEST__stats(TEST__FADER);
+    UNIT_CHECK(stats.jobs == 2);
+    UNIT_CHECK(stats.overruns == 1);
+    UNIT_CHECK(stats.max_cycles == TEST__US(360));
+
+    /* The next job starts from zero */
+    TEST__run(TEST__US(1000));
+    TEST__start(TEST__FADER);
+    TEST__run(TEST__US(190));
+    TEST__terminate(EE_NIL);
+    stats = TEST__stats(TEST__FADER);
+    UNIT_CHECK(stats.jobs == 3);
+    UNIT_CHECK(stats.overruns == 1);
+    UNIT_CHECK(stats.job_cycles == TEST__US(190));
+}
+
+static void TEST__preemption(void)
+{
+    /* The glower preempts the fader: each job only carries its own time */
+    TEST__run(TEST__US(1000));
+    TEST__start(TEST__FADER);
+    TEST__run(TEST__US(120));
+    TEST__isrEnter();
+    TEST__run(TEST__US(20));
+    /* EE_IRQ_end_instance() dispatches the released glower */
+    EE_as_tp_active_reset_budgets();
+    --TEST__nesting;
+    EE_as_tp_active_update_budgets_and_restart();
+    TEST__start(TEST__GLOWER);
+    TEST__run(TEST__US(180));
+    TEST__terminate(TEST__FADER);
+    TEST__run(TEST__US(70));
+    TEST__terminate(EE_NIL);
+
+    EE_as_eb_RAM_type fader = TEST__stats(TEST__FADER);
+    EE_as_eb_RAM_type glower = TEST__stats(TEST__GLOWER);
+    UNIT_CHECK(fader.overruns == 1);
+    UNIT_CHECK(fader.job_cycles == TEST__US(190));
+    UNIT_CHECK(glower.jobs == 1);
+    UNIT_CHECK(glower.overruns == 0);
+    UNIT_CHECK(glower.max_cycles == TEST__US(180));
+}
+
+static void TEST__interarrival(void)
+{
+    uint32_t violations = TEST__stats(TEST__FADER).arrival_violations;
+
+    /* Regular 1 ms cycle */
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        TEST__run(TEST__US(1000));
+        TEST__start(TEST__FADER);
+        TEST__terminate(EE_NIL);
+    }
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations);
+
+    /* Injected early arrival, 500 us after the last one */
+    TEST__run(TEST__US(500));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 1);
+
+    /* The distance is taken from the early arrival */
+    TEST__run(TEST__US(899));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 2);
+    TEST__run(TEST__US(900));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 2);
+
+    /* Without an inter-arrival time nothing is checked, the first arrival never */
+    TEST__start(TEST__REACTIONGAME);
+    TEST__terminate(EE_NIL);
+    TEST__start(TEST__REACTIONGAME);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__REACTIONGAME).arrival_violations == 0);
+    UNIT_CHECK(TEST__stats(TEST__REACTIONGAME).arrived == EE_TRUE);
+}
+
+static void TEST__divider(void)
+{
+    uint32_t violations = TEST__stats(TEST__FADER).arrival_violations;
+    EE_as_eb_RAM_type before = TEST__stats(TEST__GLOWER);
+
+    UNIT_CHECK(SetExecutionBudgetDivider(0) == E_OS_VALUE);
+
+    /* Half the clock: 1 ms are half the cycles, still no early arrival */
+    TEST__run(TEST__US(1000));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    TEST__run(TEST__US(300));
+    UNIT_CHECK(SetExecutionBudgetDivider(2) == E_OK);
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        TEST__run(TEST__US(i == 0 ? 350 : 500));
+        TEST__start(TEST__FADER);
+        TEST__terminate(EE_NIL);
+    }
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations);
+
+    /* An arrival 500 us early is still one */
+    TEST__run(TEST__US(250));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 1);
+
+    /* Budgets stay cycles: 180 us of work take 360 us */
+    TEST__start(TEST__GLOWER);
+    TEST__run(TEST__US(180));
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__GLOWER).overruns == before.overruns);
+
+    /* The divided arrival clock across a wrap of the DWT counter */
+    EE_UINT32 previous;
+    do
+    {
+        previous = TEST__dwt;
+        TEST__run(TEST__US(500));
+        TEST__start(TEST__FADER);
+        TEST__terminate(EE_NIL);
+    } while (TEST__dwt > previous);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 1);
+
+    /* Back at full speed */
+    UNIT_CHECK(SetExecutionBudgetDivider(1) == E_OK);
+    TEST__run(TEST__US(900));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 1);
+    TEST__run(TEST__US(899));
+    TEST__start(TEST__FADER);
+    TEST__terminate(EE_NIL);
+    UNIT_CHECK(TEST__stats(TEST__FADER).arrival_violations == violations + 2);
+}
+
+int main(void)
+{
+    EE_as_eb_init();
+
+    TEST__params();
+    TEST__withinBudget();
+    TEST__overrun();
+    TEST__preemption();
+    TEST__interarrival();
+    TEST__divider();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,235 @@
+/**
+* \file test_fmt.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test and benchmark of the decimal formatter
+*
+* The multiply-shift division is checked for every uint32_t, the output
+* against snprintf() for every uint16_t, the uint32_t digit boundaries and
+* a stride through the whole uint32_t range, with and without padding.
+* Buffers one byte too small and smaller are refused without writing past
+* their end. The benchmark prints the host time per number of FMT_U32()
+* and snprintf().
+*/
+
+#include <string.h>
+#include "unit.h"
+#include "../source/bsw/fmt.c"
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+#define TEST__CANARY        0x5A        /**< Fill behind the buffer under test */
+#define TEST__STRIDE        65521u      /**< Prime stride through the uint32_t range */
+#define TEST__BENCH_ROUNDS  64u
+
+/** Boundaries of the digit count and of the bit width */
+static uint32_t TEST__edges[3 * FMT__MAX_DIGITS + 3 * 32 + 2];
+static uint16_t TEST__edgeCount;
+
+static void TEST__addEdges(void)
+{
+    uint32_t power = 1;
+
+    for (uint8_t i = 0; i < FMT__MAX_DIGITS; ++i)
+    {
+        TEST__edges[TEST__edgeCount++] = power - 1;
+        TEST__edges[TEST__edgeCount++] = power;
+        TEST__edges[TEST__edgeCount++] = power + 1;
+        power *= 10;
+    }
+    for (uint8_t bit = 0; bit < 32; ++bit)
+    {
+        TEST__edges[TEST__edgeCount++] = (1u << bit) - 1;
+        TEST__edges[TEST__edgeCount++] = 1u << bit;
+        TEST__edges[TEST__edgeCount++] = (1u << bit) + 1;
+    }
+    TEST__edges[TEST__edgeCount++] = 0xFFFFFFFEu;
+    TEST__edges[TEST__edgeCount++] = 0xFFFFFFFFu;
+}
+
+/** Formats value and compares with snprintf(), FALSE on any difference */
+static boolean_t TEST__matches(uint32_t value, uint8_t width, char_t pad)
+{
+    char_t expected[32];
+    char_t buffer[32];
+    uint8_t length = 0;
+    int n = (pad == '0') ? snprintf(expected, sizeof(expected), "%0*u", width, value)
+                         : snprintf(expected, sizeof(expected), "%*u", width, value);
+
+    if (FMT_U32Width(value, width, pad, buffer, sizeof(buffer), &length) != RC_SUCCESS)
+    {
+        return FALSE;
+    }
+    return ((length == n) && (strcmp(buffer, expected) == 0)) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__division(void)
+{
+    uint32_t value = 0;
+    boolean_t exact = TRUE;
+
+    /* Every uint32_t */
+    do
+    {
+        exact = (FMT__DIV100(value) == value / 100) ? exact : FALSE;
+    } while (++value != 0);
+    UNIT_CHECK(exact == TRUE);
+}
+
+static void TEST__values(void)
+{
+    boolean_t same = TRUE;
+
+    for (uint32_t value = 0; value <= 0xFFFFu; ++value)
+    {
+        same = TEST__matches(value, 0, ' ') ? same : FALSE;
+    }
+    UNIT_CHECK(same == TRUE);
+
+    for (uint16_t i = 0; i < TEST__edgeCount; ++i)
+    {
+        UNIT_CHECK(TEST__matches(TEST__edges[i], 0, ' ') == TRUE);
+    }
+
+    same = TRUE;
+    for (uint64_t value = 0; value <= 0xFFFFFFFFu; value += TEST__STRIDE)
+    {
+        same = TEST__matches((uint32_t)value, 0, ' ') ? same : FALSE;
+    }
+    UNIT_CHECK(same == TRUE);
+}
+
+static void TEST__width(void)
+{
+    char_t buffer[8];
+    uint8_t length = 0;
+    boolean_t same = TRUE;
+
+    for (uint16_t i = 0; i < TEST__edgeCount; ++i)
+    {
+        for (uint8_t width = 0; width <= 16; ++width)
+        {
+            same = TEST__matches(TEST__edges[i], width, '0') ? same : FALSE;
+            same = TEST__matches(TEST__edges[i], width, ' ') ? same : FALSE;
+        }
+    }
+    UNIT_CHECK(same == TRUE);
+
+    /* Any fill character, the number is never cut */
+    UNIT_CHECK(FMT_U32Width(42, 5, '*', buffer, sizeof(buffer), &length) == RC_SUCCESS);
+    UNIT_CHECK((strcmp(buffer, "***42") == 0) && (length == 5));
+    UNIT_CHECK(FMT_U32Width(123456, 2, '0', buffer, sizeof(buffer), &length) == RC_SUCCESS);
+    UNIT_CHECK((strcmp(buffer, "123456") == 0) && (length == 6));
+
+    /* The width has to fit like the digits */
+    UNIT_CHECK(FMT_U32Width(1, sizeof(buffer), '0', buffer, sizeof(buffer), &length) == RC_ERROR_BUFFER_FULL);
+    UNIT_CHECK(FMT_U32Width(1, sizeof(buffer) - 1, '0', buffer, sizeof(buffer), &length) == RC_SUCCESS);
+}
+
+static void TEST__bounds(void)
+{
+    char_t buffer[FMT_U32_SIZE + 4];
+    uint8_t length;
+    boolean_t intact = TRUE;
+    boolean_t refused = TRUE;
+
+    UNIT_CHECK(FMT_U32(1, NULL, 4, &length) == RC_ERROR_NULL);
+    UNIT_CHECK(FMT_U32(1, buffer, sizeof(buffer), NULL) == RC_SUCCESS);
+
+    /* The size macros suffice for their whole type */
+    UNIT_CHECK(FMT_U32(0xFFu, buffer, FMT_U8_SIZE, &length) == RC_SUCCESS);
+    UNIT_CHECK(FMT_U32(0xFFFFu, buffer, FMT_U16_SIZE, &length) == RC_SUCCESS);
+    UNIT_CHECK(FMT_U32(0xFFFFFFFFu, buffer, FMT_U32_SIZE, &length) == RC_SUCCESS);
+
+    /* Every size up to one too small: refused, empty, nothing behind size written */
+    for (uint16_t i = 0; i < TEST__edgeCount; ++i)
+    {
+        uint8_t digits = FMT__digits(TEST__edges[i]);
+
+        for (uint8_t size = 0; size <= digits; ++size)
+        {
+            memset(buffer, TEST__CANARY, sizeof(buffer));
+            length = 0xFF;
+            refused = (FMT_U32(TEST__edges[i], buffer, size, &length) == RC_ERROR_BUFFER_FULL) ? refused : FALSE;
+            refused = (length == 0xFF) ? refused : FALSE;
+            if (size > 0)
+            {
+                refused = (buffer[0] == '\0') ? refused : FALSE;
+            }
+            for (uint8_t j = (size > 0) ? 1 : 0; j < sizeof(buffer); ++j)
+            {
+                intact = (buffer[j] == (char_t)TEST__CANARY) ? intact : FALSE;
+            }
+        }
+
+        /* Exactly large enough, only digits and terminator are written */
+        memset(buffer, TEST__CANARY, sizeof(buffer));
+        UNIT_CHECK(FMT_U32(TEST__edges[i], buffer, digits + 1, &length) == RC_SUCCESS);
+        UNIT_CHECK(length == digits);
+        intact = (buffer[digits + 1] == (char_t)TEST__CANARY) ? intact : FALSE;
+    }
+    UNIT_CHECK(refused == TRUE);
+    UNIT_CHECK(intact == TRUE);
+}
+
+static void TEST__benchmark(void)
+{
+    static uint32_t values[1024];
+    char_t buffer[FMT_U32_SIZE];
+    uint32_t lcg = 1;
+    uint32_t sum = 0;
+
+    /* Mixed lengths, as many short as long numbers */
+    for (uint16_t i = 0; i < 1024; ++i)
+    {
+        lcg = lcg * 1664525u + 1013904223u;
+        values[i] = lcg >> (lcg & 0x1Fu);
+    }
+
+    unsigned long long start = UNIT_Nanoseconds();
+    for (uint32_t round = 0; round < TEST__BENCH_ROUNDS; ++round)
+    {
+        for (uint16_t i = 0; i < 1024; ++i)
+        {
+            uint8_t length = 0;
+            (void)FMT_U32(values[i], buffer, sizeof(buffer), &length);
+            sum += length + (uint8_t)buffer[0];
+        }
+    }
+    unsigned long long fmt = UNIT_Nanoseconds() - start;
+
+    start = UNIT_Nanoseconds();
+    for (uint32_t round = 0; round < TEST__BENCH_ROUNDS; ++round)
+    {
+        for (uint16_t i = 0; i < 1024; ++i)
+        {
+            int length = snprintf(buffer, sizeof(buffer), "%u", values[i]);
+            sum += (uint32_t)length + (uint8_t)buffer[0];
+        }
+    }
+    unsigned long long libc = UNIT_Nanoseconds() - start;
+
+    UNIT_CHECK(sum != 0);
+    printf("format [ns]: FMT_U32 %.1f, snprintf %.1f\n",
+           (double)fmt / (TEST__BENCH_ROUNDS * 1024), (double)libc / (TEST__BENCH_ROUNDS * 1024));
+}
+
+int main(void)
+{
+    TEST__addEdges();
+
+    TEST__division();
+    TEST__values();
+    TEST__width();
+    TEST__bounds();
+    TEST__benchmark();
+
+    return UNIT_RESULT();
+}
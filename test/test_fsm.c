@@ -0,0 +1,291 @@
+/**
+* \file test_fsm.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test and dispatch benchmark of the state machine engine
+*
+* The table of the reaction game is modelled with counting actions. The
+* engine is checked for its parameter handling, ignored cells, rejected
+* next states and the coverage counters. The benchmark dispatches the same
+* random event sequence through FSM_Dispatch() and through an else-if chain
+* like the one tsk_reactionGame used before, and prints both costs.
+*/
+
+#include "unit.h"
+#include "../source/bsw/fsm.c"
+
+/*****************************************************************************/
+/* Game model                                                                */
+/*****************************************************************************/
+
+#define TEST__DISPATCHES    (1UL << 24)     /**< Dispatches per benchmark run */
+#define TEST__SEQUENCE      4096u           /**< Length of the random event sequence */
+
+typedef enum {
+    TEST__WAIT_START,
+    TEST__WAIT_DISPLAY,
+    TEST__WAIT_REACTION,
+    TEST__NONE,
+    TEST__STATES
+} TEST__state_t;
+
+typedef enum {
+    TEST__EV_RESTART,
+    TEST__EV_SHOW_DIGIT,
+    TEST__EV_PRESS,
+    TEST__EV_TIMEOUT,
+    TEST__EVENTS
+} TEST__event_t;
+
+/** Calls per action, the context of every action */
+typedef struct {
+    uint32_t restart;
+    uint32_t startRound;
+    uint32_t showDigit;
+    uint32_t dropPresses;
+    uint32_t evaluatePress;
+    uint32_t timeout;
+} TEST__context_t;
+
+static FSM_state_t TEST__restart(FSM_state_t state, void* context)
+{
+    (void)state;
+    ++((TEST__context_t*)context)->restart;
+    return TEST__WAIT_START;
+}
+
+static FSM_state_t TEST__startRound(FSM_state_t state, void* context)
+{
+    (void)state;
+    ++((TEST__context_t*)context)->startRound;
+    return TEST__WAIT_DISPLAY;
+}
+
+static FSM_state_t TEST__showDigit(FSM_state_t state, void* context)
+{
+    (void)state;
+    ++((TEST__context_t*)context)->showDigit;
+    return TEST__WAIT_REACTION;
+}
+
+static FSM_state_t TEST__dropPresses(FSM_state_t state, void* context)
+{
+    ++((TEST__context_t*)context)->dropPresses;
+    return state;
+}
+
+static FSM_state_t TEST__evaluatePress(FSM_state_t state, void* context)
+{
+    (void)state;
+    ++((TEST__context_t*)context)->evaluatePress;
+    return TEST__WAIT_START;
+}
+
+static FSM_state_t TEST__timeout(FSM_state_t state, void* context)
+{
+    (void)state;
+    ++((TEST__context_t*)context)->timeout;
+    return TEST__WAIT_START;
+}
+
+static FSM_state_t TEST__invalid(FSM_state_t state, void* context)
+{
+    (void)state;
+    (void)context;
+    return TEST__STATES;
+}
+
+static const FSM_action_t TEST__table[][TEST__EVENTS] = {
+    /*                    restart        showDigit        press                timeout       */
+    [TEST__WAIT_START]    = {TEST__restart, FSM_IGNORE,      TEST__startRound,    FSM_IGNORE},
+    [TEST__WAIT_DISPLAY]  = {FSM_IGNORE,    TEST__showDigit, TEST__dropPresses,   FSM_IGNORE},
+    [TEST__WAIT_REACTION] = {FSM_IGNORE,    FSM_IGNORE,      TEST__evaluatePress, TEST__timeout},
+    [TEST__NONE]          = {FSM_IGNORE,    FSM_IGNORE,      FSM_IGNORE,          TEST__invalid}
+};
+FSM_STATIC_ASSERT(FSM_ROWS(TEST__table) == TEST__STATES, testRows);
+
+/** The same transitions as an else-if chain over event and state */
+static FSM_state_t TEST__chain(FSM_state_t state, FSM_event_t event, TEST__context_t* context)
+{
+    if (event == TEST__EV_RESTART)
+    {
+        if (state == TEST__WAIT_START)
+        {
+            return TEST__restart(state, context);
+        }
+    }
+    else if (event == TEST__EV_SHOW_DIGIT)
+    {
+        if (state == TEST__WAIT_DISPLAY)
+        {
+            return TEST__showDigit(state, context);
+        }
+    }
+    else if (event == TEST__EV_PRESS)
+    {
+        if (state == TEST__WAIT_START)
+        {
+            return TEST__startRound(state, context);
+        }
+        else if (state == TEST__WAIT_DISPLAY)
+        {
+            return TEST__dropPresses(state, context);
+        }
+        else if (state == TEST__WAIT_REACTION)
+        {
+            return TEST__evaluatePress(state, context);
+        }
+    }
+    else if (event == TEST__EV_TIMEOUT)
+    {
+        if (state == TEST__WAIT_REACTION)
+        {
+            return TEST__timeout(state, context);
+        }
+    }
+    return state;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    FSM_t fsm;
+    TEST__context_t context = {0};
+    FSM_state_t state;
+    uint16_t defined, hit, count;
+    uint32_t ignored;
+
+    UNIT_CHECK(FSM_Init(NULL, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, 0, &context, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(FSM_Init(&fsm, NULL, TEST__STATES, TEST__EVENTS, 0, &context, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], 0, TEST__EVENTS, 0, &context, NULL) == RC_ERROR_ZERO);
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, 0, 0, &context, NULL) == RC_ERROR_ZERO);
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__STATES, &context, NULL) == RC_ERROR_BAD_PARAM);
+
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__WAIT_START, &context, NULL) == RC_SUCCESS);
+    UNIT_CHECK(FSM_Dispatch(NULL, TEST__EV_PRESS) == RC_ERROR_NULL);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EVENTS) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(FSM_GetState(&fsm, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(FSM_GetState(&fsm, &state) == RC_SUCCESS);
+    UNIT_CHECK(state == TEST__WAIT_START);
+
+    /* Without counters there is no coverage */
+    UNIT_CHECK(FSM_GetCoverage(&fsm, &defined, &hit, &ignored) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(FSM_GetCoverage(&fsm, NULL, &hit, &ignored) == RC_ERROR_NULL);
+    UNIT_CHECK(FSM_GetTransitionCount(&fsm, 0, 0, &count) == RC_ERROR_INVALID_STATE);
+}
+
+static void TEST__dispatch(void)
+{
+    static uint16_t coverage[TEST__STATES * TEST__EVENTS];
+    FSM_t fsm;
+    TEST__context_t context = {0};
+    FSM_state_t state;
+    uint16_t defined, hit, count;
+    uint32_t ignored;
+
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__WAIT_START, &context, coverage) == RC_SUCCESS);
+
+    /* A round: ignored timeout, start, press while waiting, digit, press */
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_TIMEOUT) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_PRESS) == RC_SUCCESS);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_PRESS) == RC_SUCCESS);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_SHOW_DIGIT) == RC_SUCCESS);
+    (void)FSM_GetState(&fsm, &state);
+    UNIT_CHECK(state == TEST__WAIT_REACTION);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_PRESS) == RC_SUCCESS);
+    (void)FSM_GetState(&fsm, &state);
+    UNIT_CHECK(state == TEST__WAIT_START);
+    UNIT_CHECK((context.startRound == 1) && (context.dropPresses == 1) &&
+               (context.showDigit == 1) && (context.evaluatePress == 1));
+
+    /* 6 cells with an action in the game rows plus the invalid one, 4 hit */
+    UNIT_CHECK(FSM_GetCoverage(&fsm, &defined, &hit, &ignored) == RC_SUCCESS);
+    UNIT_CHECK(defined == 7);
+    UNIT_CHECK(hit == 4);
+    UNIT_CHECK(ignored == 1);
+    UNIT_CHECK(FSM_GetTransitionCount(&fsm, TEST__STATES, 0, &count) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(FSM_GetTransitionCount(&fsm, TEST__WAIT_DISPLAY, TEST__EV_PRESS, &count) == RC_SUCCESS);
+    UNIT_CHECK(count == 1);
+
+    /* The counters saturate */
+    for (uint32_t i = 0; i < 70000u; ++i)
+    {
+        (void)FSM_Dispatch(&fsm, TEST__EV_RESTART);
+    }
+    UNIT_CHECK(FSM_GetTransitionCount(&fsm, TEST__WAIT_START, TEST__EV_RESTART, &count) == RC_SUCCESS);
+    UNIT_CHECK(count == FSM__COUNT_MAX);
+    UNIT_CHECK(context.restart == 70000u);
+
+    /* An action returning an invalid state does not change the state */
+    UNIT_CHECK(FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__NONE, &context, NULL) == RC_SUCCESS);
+    UNIT_CHECK(FSM_Dispatch(&fsm, TEST__EV_TIMEOUT) == RC_ERROR_INVALID_STATE);
+    (void)FSM_GetState(&fsm, &state);
+    UNIT_CHECK(state == TEST__NONE);
+}
+
+static void TEST__benchmark(void)
+{
+    static FSM_event_t sequence[TEST__SEQUENCE];
+    static uint16_t coverage[TEST__STATES * TEST__EVENTS];
+    uint32_t lcg = 12345u;
+    FSM_t fsm;
+    TEST__context_t tableContext = {0};
+    TEST__context_t chainContext = {0};
+
+    /* Presses dominate like in the game */
+    for (uint16_t i = 0; i < TEST__SEQUENCE; ++i)
+    {
+        lcg = lcg * 1664525u + 1013904223u;
+        uint8_t r = (uint8_t)(lcg >> 24);
+        sequence[i] = (r < 128) ? TEST__EV_PRESS : (FSM_event_t)(r & 0x03u);
+    }
+
+    (void)FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__WAIT_START, &tableContext, NULL);
+    unsigned long long start = UNIT_Nanoseconds();
+    for (uint32_t i = 0; i < TEST__DISPATCHES; ++i)
+    {
+        (void)FSM_Dispatch(&fsm, sequence[i & (TEST__SEQUENCE - 1)]);
+    }
+    unsigned long long table = UNIT_Nanoseconds() - start;
+
+    (void)FSM_Init(&fsm, &TEST__table[0][0], TEST__STATES, TEST__EVENTS, TEST__WAIT_START, &tableContext, coverage);
+    start = UNIT_Nanoseconds();
+    for (uint32_t i = 0; i < TEST__DISPATCHES; ++i)
+    {
+        (void)FSM_Dispatch(&fsm, sequence[i & (TEST__SEQUENCE - 1)]);
+    }
+    unsigned long long counted = UNIT_Nanoseconds() - start;
+
+    FSM_state_t state = TEST__WAIT_START;
+    start = UNIT_Nanoseconds();
+    for (uint32_t i = 0; i < TEST__DISPATCHES; ++i)
+    {
+        state = TEST__chain(state, sequence[i & (TEST__SEQUENCE - 1)], &chainContext);
+    }
+    unsigned long long chain = UNIT_Nanoseconds() - start;
+
+    /* Both runs of the table against one run of the chain */
+    FSM_state_t tableState;
+    (void)FSM_GetState(&fsm, &tableState);
+    UNIT_CHECK(tableState == state);
+    UNIT_CHECK(tableContext.evaluatePress == 2 * chainContext.evaluatePress);
+    UNIT_CHECK(tableContext.dropPresses == 2 * chainContext.dropPresses);
+    UNIT_CHECK(tableContext.timeout == 2 * chainContext.timeout);
+
+    printf("dispatch [ns]: table %.2f, table with coverage %.2f, else-if chain %.2f\n",
+           (double)table / TEST__DISPATCHES, (double)counted / TEST__DISPATCHES,
+           (double)chain / TEST__DISPATCHES);
+}
+
+int main(void)
+{
+    TEST__params();
+    TEST__dispatch();
+    TEST__benchmark();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,232 @@
+/**
+* \file test_prng.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test of the PRNG distribution and cost per call
+*
+* The generator is compared with the published xoshiro128** step, the
+* bounded draws are checked with a chi-square test over power-of-two and
+* other bounds. A bound of about 2/3 * 2^32 makes the plain multiply-shift
+* return even values twice as often as odd ones, so the rejection path of
+* PRNG_Draw() has to remove a bias the same test finds without it. The
+* benchmark prints the host time per draw.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "unit.h"
+#include "../source/bsw/prng.c"
+
+/*****************************************************************************/
+/* Reference and statistics                                                  */
+/*****************************************************************************/
+
+#define TEST__PER_BUCKET    2000u           /**< Expected draws per value of a bound */
+#define TEST__Z_999         3.09            /**< Normal quantile of p = 0.999 */
+#define TEST__TWO_THIRDS    0xAAAAAAABu     /**< Bound where the plain mapping favours even values */
+#define TEST__BENCH_DRAWS   (1UL << 24)
+
+/** xoshiro128** as published by Blackman and Vigna */
+static uint32_t TEST__reference(uint32_t s[4])
+{
+    uint32_t const result = ((((s[1] * 5u) << 7) | ((s[1] * 5u) >> 25))) * 9u;
+    uint32_t const t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+
+    return result;
+}
+
+/** Chi-square bound of df degrees of freedom at p = 0.999 (Wilson-Hilferty) */
+static double TEST__chiSquareLimit(uint32_t df)
+{
+    double const a = 2.0 / (9.0 * df);
+    double const b = 1.0 - a + TEST__Z_999 * sqrt(a);
+
+    return df * b * b * b;
+}
+
+static double TEST__chiSquare(const uint32_t* counts, uint32_t buckets, uint32_t draws)
+{
+    double const expected = (double)draws / buckets;
+    double sum = 0.0;
+
+    for (uint32_t i = 0; i < buckets; ++i)
+    {
+        double const d = counts[i] - expected;
+        sum += d * d / expected;
+    }
+    return sum;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    PRNG_t prng;
+    uint32_t value;
+
+    UNIT_CHECK(PRNG_Create(NULL, 1) == RC_ERROR_NULL);
+    UNIT_CHECK(PRNG_Create(&prng, 1) == RC_SUCCESS);
+    UNIT_CHECK(PRNG_Draw(NULL, 10, &value) == RC_ERROR_NULL);
+    UNIT_CHECK(PRNG_Draw(&prng, 10, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(PRNG_Draw(&prng, 0, &value) == RC_ERROR_ZERO);
+    UNIT_CHECK(PRNG_Next(NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(PRNG_Range(0, &value) == RC_ERROR_ZERO);
+
+    /* The smallest and the largest bound */
+    UNIT_CHECK((PRNG_Draw(&prng, 1, &value) == RC_SUCCESS) && (value == 0));
+    UNIT_CHECK(PRNG_Draw(&prng, 0xFFFFFFFFu, &value) == RC_SUCCESS);
+    UNIT_CHECK(value < 0xFFFFFFFFu);
+}
+
+static void TEST__sequence(void)
+{
+    PRNG_t prng;
+    PRNG_t again;
+    uint32_t reference[PRNG_STATE_WORDS];
+    boolean_t same = TRUE;
+
+    /* The preset game generator equals PRNG_Init(0) */
+    UNIT_CHECK(PRNG_Create(&prng, 0) == RC_SUCCESS);
+    UNIT_CHECK(memcmp(&prng, &PRNG__game, sizeof(prng)) == 0);
+
+    /* The step is xoshiro128** */
+    memcpy(reference, prng.state, sizeof(reference));
+    for (uint16_t i = 0; i < 1000; ++i)
+    {
+        same = (PRNG__next(&prng) == TEST__reference(reference)) ? same : FALSE;
+    }
+    UNIT_CHECK(same == TRUE);
+
+    /* Same seed, same sequence; another seed, another one */
+    (void)PRNG_Create(&prng, 1234);
+    (void)PRNG_Create(&again, 1234);
+    UNIT_CHECK(memcmp(&prng, &again, sizeof(prng)) == 0);
+    (void)PRNG_Create(&again, 1235);
+    UNIT_CHECK(PRNG__next(&prng) != PRNG__next(&again));
+
+    /* Entropy changes the game sequence and never leaves the all-zero state */
+    uint32_t before;
+    uint32_t after;
+    (void)PRNG_Init(7);
+    (void)PRNG_Next(&before);
+    (void)PRNG_Init(7);
+    (void)PRNG_AddEntropy(0x1234u);
+    (void)PRNG_Next(&after);
+    UNIT_CHECK(before != after);
+    memset(PRNG__game.state, 0, sizeof(PRNG__game.state));
+    PRNG__game.stream = 0;
+    (void)PRNG_AddEntropy(0u);
+    UNIT_CHECK((PRNG__game.state[0] | PRNG__game.state[1] | PRNG__game.state[2] | PRNG__game.state[3]) != 0);
+}
+
+static void TEST__distribution(void)
+{
+    /* Game ranges, powers of two and bounds which need the rejection */
+    static const uint32_t bounds[] = {2, 3, 4, 6, 7, 9, 10, 16, 100, 255, 1000};
+    static uint32_t counts[1000];
+    PRNG_t prng;
+
+    (void)PRNG_Create(&prng, 0xC0FFEEu);
+
+    for (uint8_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); ++b)
+    {
+        uint32_t const bound = bounds[b];
+        uint32_t const draws = bound * TEST__PER_BUCKET;
+        boolean_t inRange = TRUE;
+
+        memset(counts, 0, sizeof(counts));
+        for (uint32_t i = 0; i < draws; ++i)
+        {
+            uint32_t value;
+            (void)PRNG_Draw(&prng, bound, &value);
+            if (value < bound)
+            {
+                ++counts[value];
+            }
+            else
+            {
+                inRange = FALSE;
+            }
+        }
+
+        double const chi = TEST__chiSquare(counts, bound, draws);
+        UNIT_CHECK(inRange == TRUE);
+        UNIT_CHECK(chi < TEST__chiSquareLimit(bound - 1));
+        printf("bound %4u: chi-square %7.1f, limit %7.1f\n", bound, chi, TEST__chiSquareLimit(bound - 1));
+    }
+}
+
+static void TEST__rejection(void)
+{
+    uint32_t const draws = 1000000u;
+    uint32_t drawn[2] = {0, 0};
+    uint32_t plain[2] = {0, 0};
+    PRNG_t prng;
+    PRNG_t raw;
+
+    (void)PRNG_Create(&prng, 42);
+    (void)PRNG_Create(&raw, 42);
+
+    for (uint32_t i = 0; i < draws; ++i)
+    {
+        uint32_t value;
+        (void)PRNG_Draw(&prng, TEST__TWO_THIRDS, &value);
+        ++drawn[value & 1u];
+        /* The mapping without the rejection */
+        ++plain[(uint32_t)(((uint64_t)PRNG__next(&raw) * TEST__TWO_THIRDS) >> 32) & 1u];
+    }
+
+    double const limit = TEST__chiSquareLimit(1);
+    double const chiDrawn = TEST__chiSquare(drawn, 2, draws);
+    double const chiPlain = TEST__chiSquare(plain, 2, draws);
+    UNIT_CHECK(chiDrawn < limit);
+    UNIT_CHECK(chiPlain > limit);
+    printf("bound 0x%08X parity: chi-square %.1f with rejection, %.1f without, limit %.1f\n",
+           TEST__TWO_THIRDS, chiDrawn, chiPlain, limit);
+}
+
+static void TEST__benchmark(void)
+{
+    static const uint32_t bounds[] = {10, 1000, TEST__TWO_THIRDS};
+    PRNG_t prng;
+    uint32_t sum = 0;
+
+    (void)PRNG_Create(&prng, 1);
+
+    for (uint8_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); ++b)
+    {
+        unsigned long long const start = UNIT_Nanoseconds();
+        for (uint32_t i = 0; i < TEST__BENCH_DRAWS; ++i)
+        {
+            uint32_t value = 0;
+            (void)PRNG_Draw(&prng, bounds[b], &value);
+            sum += value;
+        }
+        unsigned long long const elapsed = UNIT_Nanoseconds() - start;
+        printf("PRNG_Draw bound %u: %.2f ns\n", bounds[b], (double)elapsed / TEST__BENCH_DRAWS);
+    }
+
+    /* Keeps the draws alive */
+    UNIT_CHECK(sum != 0);
+}
+
+int main(void)
+{
+    TEST__params();
+    TEST__sequence();
+    TEST__distribution();
+    TEST__rejection();
+    TEST__benchmark();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,249 @@
+/**
+* \file test_replay.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host round trip test of the input recording and replay
+*
+* A model of the game hooks runs for a few thousand ticks on live inputs
+* drawn from one generator and records them. The recording is then played
+* back while the live inputs come from another generator: the game has to
+* see the same seed, entropy and stimuli at the same ticks. The limits of
+* the recording and a session which does not match the game are checked as
+* well.
+*/
+
+#include <string.h>
+#include "unit.h"
+#include "../source/asw/replay.c"
+
+/*****************************************************************************/
+/* Kernel and game model                                                     */
+/*****************************************************************************/
+
+#define TEST__TICKS         5000u   /**< Length of the played game [ms] */
+#define TEST__TRACE         512u    /**< Inputs the game model can note */
+
+void SuspendOSInterrupts(void)
+{
+}
+
+void ResumeOSInterrupts(void)
+{
+}
+
+/** One input as the game saw it */
+typedef struct {
+    uint32_t tick;
+    uint32_t value;
+    uint16_t timestamp;
+    uint8_t  buttons;
+    uint8_t  kind;
+} TEST__input_t;
+
+typedef struct {
+    TEST__input_t input[TEST__TRACE];
+    uint16_t count;
+} TEST__trace_t;
+
+static void TEST__note(TEST__trace_t* trace, uint32_t tick, REPLAY_kind_t kind, uint32_t value,
+                       const CAPTURE_event_t* event)
+{
+    if (trace->count < TEST__TRACE)
+    {
+        TEST__input_t* input = &trace->input[trace->count++];
+        input->tick = tick;
+        input->value = value;
+        input->timestamp = (event != NULL) ? event->timestamp : 0;
+        input->buttons = (event != NULL) ? event->buttons : 0;
+        input->kind = (uint8_t)kind;
+    }
+}
+
+static uint32_t TEST__lcg(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+/** A press takes an entropy sample like the round start of the game */
+static void TEST__press(TEST__trace_t* trace, uint32_t tick, const CAPTURE_event_t* event, uint32_t live)
+{
+    uint32_t sample = live;
+
+    TEST__note(trace, tick, REPLAY_BUTTON, 0, event);
+    UNIT_CHECK(REPLAY_Value(REPLAY_ENTROPY, &sample) == RC_SUCCESS);
+    TEST__note(trace, tick, REPLAY_ENTROPY, sample, NULL);
+}
+
+/**
+ * Runs the game hooks for TEST__TICKS ticks on the live inputs of a
+ * generator: the seed at the start, then presses and timeouts at random
+ * ticks. While replaying the live ones are dropped and the recorded ones
+ * come from the session, as in systick_handler and isr_timer.
+ */
+static void TEST__game(uint32_t generator, TEST__trace_t* trace)
+{
+    uint32_t seed = TEST__lcg(&generator);
+
+    trace->count = 0;
+    UNIT_CHECK(REPLAY_Value(REPLAY_SEED, &seed) == RC_SUCCESS);
+    TEST__note(trace, 0, REPLAY_SEED, seed, NULL);
+
+    for (uint32_t tick = 1; tick <= TEST__TICKS; ++tick)
+    {
+        uint32_t const live = TEST__lcg(&generator);
+        CAPTURE_event_t event = {(uint16_t)(live >> 16), (uint8_t)(live & 0x0Fu)};
+        REPLAY_kind_t kind;
+
+        (void)REPLAY_Tick();
+
+        if (REPLAY_IsPlaying() == TRUE)
+        {
+            while (REPLAY_GetStimulus(&kind, &event) == RC_SUCCESS)
+            {
+                if (kind == REPLAY_BUTTON)
+                {
+                    TEST__press(trace, tick, &event, live);
+                }
+                else
+                {
+                    TEST__note(trace, tick, REPLAY_TIMEOUT, 0, NULL);
+                }
+            }
+        }
+        else if ((live % 97u) == 0)
+        {
+            UNIT_CHECK(REPLAY_Stimulus(REPLAY_BUTTON, &event) == RC_SUCCESS);
+            TEST__press(trace, tick, &event, live);
+        }
+        else if ((live % 211u) == 0)
+        {
+            UNIT_CHECK(REPLAY_Stimulus(REPLAY_TIMEOUT, NULL) == RC_SUCCESS);
+            TEST__note(trace, tick, REPLAY_TIMEOUT, 0, NULL);
+        }
+    }
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    REPLAY_record_t record;
+    REPLAY_kind_t kind;
+    CAPTURE_event_t event = {0, 0};
+    uint32_t value = 0;
+    uint16_t records;
+    uint16_t dropped;
+
+    UNIT_CHECK(REPLAY_Play(NULL, 1) == RC_ERROR_NULL);
+    UNIT_CHECK(REPLAY_Play(&record, 0) == RC_ERROR_ZERO);
+    UNIT_CHECK(REPLAY_Value(REPLAY_SEED, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(REPLAY_Value(REPLAY_BUTTON, &value) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(REPLAY_Stimulus(REPLAY_SEED, &event) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(REPLAY_Stimulus(REPLAY_BUTTON, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(REPLAY_GetStimulus(NULL, &event) == RC_ERROR_NULL);
+    UNIT_CHECK(REPLAY_GetCount(NULL, &dropped) == RC_ERROR_NULL);
+    UNIT_CHECK(REPLAY_GetRecord(0, NULL) == RC_ERROR_NULL);
+
+    /* Idle: values pass unchanged, nothing is recorded or replayed */
+    value = 17;
+    UNIT_CHECK(REPLAY_Value(REPLAY_ENTROPY, &value) == RC_SUCCESS);
+    UNIT_CHECK(value == 17);
+    UNIT_CHECK(REPLAY_IsPlaying() == FALSE);
+    UNIT_CHECK(REPLAY_Stimulus(REPLAY_TIMEOUT, NULL) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(REPLAY_GetStimulus(&kind, &event) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(REPLAY_GetCount(&records, &dropped) == RC_SUCCESS);
+    UNIT_CHECK(records == 0);
+    UNIT_CHECK(REPLAY_GetRecord(0, &record) == RC_ERROR_RANGE);
+}
+
+static void TEST__roundTrip(void)
+{
+    static TEST__trace_t recorded;
+    static TEST__trace_t replayed;
+    static REPLAY_record_t session[REPLAY_RECORDS];
+    uint16_t records = 0;
+    uint16_t dropped = 0;
+    uint16_t stimuli = 0;
+
+    UNIT_CHECK(REPLAY_Record() == RC_SUCCESS);
+    TEST__game(1, &recorded);
+    UNIT_CHECK(REPLAY_GetCount(&records, &dropped) == RC_SUCCESS);
+    UNIT_CHECK(dropped == 0);
+    UNIT_CHECK(records == recorded.count);
+    for (uint16_t i = 0; i < records; ++i)
+    {
+        UNIT_CHECK(REPLAY_GetRecord(i, &session[i]) == RC_SUCCESS);
+        stimuli += ((session[i].kind == REPLAY_BUTTON) || (session[i].kind == REPLAY_TIMEOUT)) ? 1 : 0;
+    }
+    /* A game long enough to hold presses and timeouts */
+    UNIT_CHECK(stimuli > 20);
+
+    /* Other live inputs, the same game */
+    UNIT_CHECK(REPLAY_Play(session, records) == RC_SUCCESS);
+    UNIT_CHECK(REPLAY_IsPlaying() == TRUE);
+    TEST__game(2, &replayed);
+    UNIT_CHECK(replayed.count == recorded.count);
+    UNIT_CHECK(memcmp(replayed.input, recorded.input, recorded.count * sizeof(TEST__input_t)) == 0);
+}
+
+static void TEST__limits(void)
+{
+    static const REPLAY_record_t shipped[] = {
+#include "replay_session.inc"
+    };
+    static const REPLAY_record_t mismatch[] = {
+        {5u, 0u, 0u, REPLAY_SEED},
+        {1u, 100u, 1u, REPLAY_BUTTON},
+        {3u, 0u, 0u, REPLAY_ENTROPY}
+    };
+    CAPTURE_event_t event = {0, 0};
+    REPLAY_kind_t kind;
+    uint32_t value = 0;
+    uint16_t records;
+    uint16_t dropped;
+
+    /* A full recording drops and counts further inputs */
+    UNIT_CHECK(REPLAY_Record() == RC_SUCCESS);
+    for (uint16_t i = 0; i < REPLAY_RECORDS; ++i)
+    {
+        UNIT_CHECK(REPLAY_Stimulus(REPLAY_TIMEOUT, NULL) == RC_SUCCESS);
+    }
+    UNIT_CHECK(REPLAY_Stimulus(REPLAY_BUTTON, &event) == RC_ERROR_BUFFER_FULL);
+    UNIT_CHECK(REPLAY_Value(REPLAY_ENTROPY, &value) == RC_ERROR_BUFFER_FULL);
+    UNIT_CHECK(REPLAY_GetCount(&records, &dropped) == RC_SUCCESS);
+    UNIT_CHECK((records == REPLAY_RECORDS) && (dropped == 2));
+
+    /* The session shipped with the tree is valid initialiser rows */
+    UNIT_CHECK(REPLAY_Play(shipped, sizeof(shipped) / sizeof(shipped[0])) == RC_SUCCESS);
+    UNIT_CHECK(REPLAY_Value(REPLAY_SEED, &value) == RC_SUCCESS);
+
+    /* A game asking for entropy where the session has a seed does not match */
+    UNIT_CHECK(REPLAY_Play(mismatch, sizeof(mismatch) / sizeof(mismatch[0])) == RC_SUCCESS);
+    UNIT_CHECK(REPLAY_Value(REPLAY_ENTROPY, &value) == RC_ERROR_BAD_DATA);
+
+    /* Stimuli are not handed out before their tick */
+    UNIT_CHECK(REPLAY_Play(mismatch, sizeof(mismatch) / sizeof(mismatch[0])) == RC_SUCCESS);
+    UNIT_CHECK(REPLAY_GetStimulus(&kind, &event) == RC_ERROR_BUFFER_EMTPY);
+    (void)REPLAY_Tick();
+    UNIT_CHECK(REPLAY_GetStimulus(&kind, &event) == RC_SUCCESS);
+    UNIT_CHECK((kind == REPLAY_BUTTON) && (event.timestamp == 100u) && (event.buttons == 1u));
+    UNIT_CHECK(REPLAY_GetStimulus(&kind, &event) == RC_ERROR_BUFFER_EMTPY);
+
+    /* Values are taken in order past the stimuli, then the session is used up */
+    UNIT_CHECK((REPLAY_Value(REPLAY_SEED, &value) == RC_SUCCESS) && (value == 5u));
+    UNIT_CHECK((REPLAY_Value(REPLAY_ENTROPY, &value) == RC_SUCCESS) && (value == 3u));
+    UNIT_CHECK(REPLAY_Value(REPLAY_ENTROPY, &value) == RC_ERROR_BAD_DATA);
+}
+
+int main(void)
+{
+    TEST__params();
+    TEST__roundTrip();
+    TEST__limits();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,237 @@
+/**
+* \file test_runtime.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host simulation of the runtime accounting and its sliding window
+*
+* A 1 ms schedule of systick, tasks and idle is played against the hooks
+* with a simulated cycle counter at 24 MHz. The loads read back are compared
+* with the shares the schedule gives each context, while the window fills,
+* while it slides over a change of the load and with nested ISRs. A
+* category 1 ISR is played as well, its time shows up in the task it hits.
+*/
+
+#define EE_MAX_TASK     3       /**< tsk_background, tsk_fader, tsk_glower */
+
+#include "unit.h"
+#include "../source/asw/runtime.c"
+
+/*****************************************************************************/
+/* Kernel and DWT model                                                      */
+/*****************************************************************************/
+
+#define TEST__IDLE          0       /**< tsk_background */
+#define TEST__FADER         1
+#define TEST__GLOWER        2
+
+#define TEST__CYCLES_MS     24000u  /**< BCLK 24 MHz */
+#define TEST__SYSTICK       240u    /**< systick_handler body, 1 % */
+#define TEST__TOLERANCE     2u      /**< Permille lost at the sample borders */
+
+uint32_t CYCLE_hostNow = 0x7FFFF000u;   /**< Wraps during the simulation */
+
+static TaskType TEST__task = INVALID_TASK;
+
+RC_t CYCLE_Init(void)
+{
+    return RC_SUCCESS;
+}
+
+StatusType GetTaskID(TaskRefType task)
+{
+    *task = TEST__task;
+    return E_OK;
+}
+
+void SuspendAllInterrupts(void)
+{
+}
+
+void ResumeAllInterrupts(void)
+{
+}
+
+/** Dispatches a task the way the kernel calls the hooks */
+static void TEST__dispatch(TaskType task)
+{
+    if (TEST__task != INVALID_TASK)
+    {
+        PostTaskHook();
+    }
+    TEST__task = task;
+    PreTaskHook();
+}
+
+/** Lets the running context execute */
+static void TEST__run(uint32_t cycles)
+{
+    CYCLE_hostNow += cycles;
+}
+
+/**
+ * Plays one millisecond: systick (which advances the window), the fader,
+ * the glower and idle for the rest. isr1 cycles of a category 1 ISR hit
+ * the fader, timer cycles of isr_timer nest into the systick.
+ */
+static void TEST__millisecond(uint32_t fader, uint32_t glower, uint32_t isr1, uint32_t timer)
+{
+    (void)RUNTIME_IsrEnter();
+    TEST__run(TEST__SYSTICK / 2);
+    if (timer != 0)
+    {
+        (void)RUNTIME_IsrEnter();
+        TEST__run(timer);
+        (void)RUNTIME_IsrExit(RUNTIME_ISR_TIMER);
+    }
+    TEST__run(TEST__SYSTICK - (TEST__SYSTICK / 2));
+    (void)RUNTIME_Tick();
+    (void)RUNTIME_IsrExit(RUNTIME_ISR_SYSTICK);
+
+    TEST__dispatch(TEST__FADER);
+    TEST__run(fader + isr1);
+    TEST__dispatch(TEST__GLOWER);
+    TEST__run(glower);
+    TEST__dispatch(TEST__IDLE);
+    TEST__run(TEST__CYCLES_MS - TEST__SYSTICK - timer - fader - glower - isr1);
+}
+
+static void TEST__play(uint16_t ms, uint32_t fader, uint32_t glower, uint32_t isr1, uint32_t timer)
+{
+    for (uint16_t i = 0; i < ms; ++i)
+    {
+        TEST__millisecond(fader, glower, isr1, timer);
+    }
+}
+
+/** Checks a load against the expected permille */
+static boolean_t TEST__near(uint16_t permille, uint16_t expected)
+{
+    uint16_t diff = (permille > expected) ? (permille - expected) : (expected - permille);
+    return (diff <= TEST__TOLERANCE) ? TRUE : FALSE;
+}
+
+static uint16_t TEST__taskLoad(TaskType task)
+{
+    uint16_t permille = 0xFFFF;
+    (void)RUNTIME_GetTaskLoad(task, &permille);
+    return permille;
+}
+
+static uint16_t TEST__isrLoad(RUNTIME_isr_t isr)
+{
+    uint16_t permille = 0xFFFF;
+    (void)RUNTIME_GetIsrLoad(isr, &permille);
+    return permille;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    uint16_t permille;
+    uint32_t cycles;
+    RUNTIME_isrBudget_t budget;
+
+    UNIT_CHECK(RUNTIME_GetTaskLoad(TEST__FADER, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(RUNTIME_GetTaskLoad(EE_MAX_TASK, &permille) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(RUNTIME_GetIsrLoad(RUNTIME_ISRS, &permille) == RC_ERROR_BAD_PARAM);
+    UNIT_CHECK(RUNTIME_GetIsrBudget(RUNTIME_ISR_TIMER, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(RUNTIME_GetIsrBudget(RUNTIME_ISR_TIMER, &budget) == RC_SUCCESS);
+    UNIT_CHECK(RUNTIME_GetTaskCycles(TEST__FADER, &cycles) == RC_SUCCESS);
+    UNIT_CHECK(RUNTIME_IsrExit(RUNTIME_ISR_TIMER) == RC_ERROR_INVALID_STATE);
+    UNIT_CHECK(RUNTIME_IsrExit(RUNTIME_ISRS) == RC_ERROR_BAD_PARAM);
+
+    /* Deeper nesting than accounted is refused, the accounted part stays intact */
+    for (uint8_t i = 0; i < RUNTIME__MAX_NESTING; ++i)
+    {
+        UNIT_CHECK(RUNTIME_IsrEnter() == RC_SUCCESS);
+    }
+    UNIT_CHECK(RUNTIME_IsrEnter() == RC_ERROR_OVERRUN);
+    for (uint8_t i = 0; i < RUNTIME__MAX_NESTING; ++i)
+    {
+        UNIT_CHECK(RUNTIME_IsrExit(RUNTIME_ISR_TIMER) == RC_SUCCESS);
+    }
+}
+
+static void TEST__window(void)
+{
+    uint16_t permille;
+
+    UNIT_CHECK(RUNTIME_Init() == RC_SUCCESS);
+    TEST__dispatch(TEST__IDLE);
+
+    /* No load before the first sample is closed */
+    TEST__play(RUNTIME_SAMPLE_MS - 1, 6000, 2400, 0, 0);
+    UNIT_CHECK(RUNTIME_GetTaskLoad(TEST__FADER, &permille) == RC_ERROR_BUFFER_EMTPY);
+
+    /* Fader 25 %, glower 10 %, systick 1 %, the first sample alone is the window */
+    TEST__play(1, 6000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 250));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__GLOWER), 100));
+    UNIT_CHECK(TEST__near(TEST__isrLoad(RUNTIME_ISR_SYSTICK), 10));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__IDLE), 640));
+
+    /* Window full */
+    TEST__play(3 * RUNTIME_SAMPLE_MS, 6000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 250));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__IDLE), 640));
+
+    /* Fader steps to 50 %: half the window sees the new load, then all of it */
+    TEST__play(2 * RUNTIME_SAMPLE_MS, 12000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 375));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__IDLE), 515));
+    TEST__play(2 * RUNTIME_SAMPLE_MS, 12000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 500));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__IDLE), 390));
+
+    /* Back to 25 %, only after a whole window the step has left it */
+    TEST__play(3 * RUNTIME_SAMPLE_MS, 6000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 312));
+    TEST__play(RUNTIME_SAMPLE_MS, 6000, 2400, 0, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 250));
+}
+
+static void TEST__nesting(void)
+{
+    RUNTIME_isrBudget_t budget;
+
+    UNIT_CHECK(RUNTIME_Init() == RC_SUCCESS);
+    TEST__dispatch(TEST__IDLE);
+
+    /* isr_timer 2 % nested into the systick: both charged net, not the task */
+    TEST__play(RUNTIME_WINDOW_SAMPLES * RUNTIME_SAMPLE_MS, 6000, 0, 0, 480);
+    UNIT_CHECK(TEST__near(TEST__isrLoad(RUNTIME_ISR_SYSTICK), 10));
+    UNIT_CHECK(TEST__near(TEST__isrLoad(RUNTIME_ISR_TIMER), 20));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 250));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__IDLE), 720));
+
+    UNIT_CHECK(RUNTIME_GetIsrBudget(RUNTIME_ISR_SYSTICK, &budget) == RC_SUCCESS);
+    UNIT_CHECK(budget.maxCycles == TEST__SYSTICK);
+    UNIT_CHECK(RUNTIME_GetIsrBudget(RUNTIME_ISR_TIMER, &budget) == RC_SUCCESS);
+    UNIT_CHECK(budget.maxCycles == 480);
+}
+
+static void TEST__category1(void)
+{
+    UNIT_CHECK(RUNTIME_Init() == RC_SUCCESS);
+    TEST__dispatch(TEST__IDLE);
+
+    /* 5 % of a category 1 ISR within the fader are charged to the fader */
+    TEST__play(RUNTIME_WINDOW_SAMPLES * RUNTIME_SAMPLE_MS, 6000, 2400, 1200, 0);
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__FADER), 300));
+    UNIT_CHECK(TEST__near(TEST__taskLoad(TEST__GLOWER), 100));
+    UNIT_CHECK(TEST__near(TEST__isrLoad(RUNTIME_ISR_SYSTICK), 10));
+}
+
+int main(void)
+{
+    TEST__params();
+    TEST__window();
+    TEST__nesting();
+    TEST__category1();
+
+    return UNIT_RESULT();
+}
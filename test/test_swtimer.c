@@ -0,0 +1,311 @@
+/**
+* \file test_swtimer.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test of the software timers on a model of the Counter
+*
+* The Counter is modelled as the one shot SWTIMER__program() sets up: its
+* interrupt comes after the programmed counts of the simulated time base and
+* runs SWTIMER_Expire(). Timers have to expire in order of their due time,
+* never early and less than one count late, cancelled and restarted ones
+* only for their last start. Periodic timers must not drift under interrupt
+* latency, delays longer than the Counter take several shots, a full heap
+* refuses further starts until a cancel frees an entry. A timer cancelled
+* 255 times leaves an entry whose 8 bit generation would match again.
+*/
+
+#include "unit.h"
+#include "project.h"
+#include "cycle.h"
+#include "Counter.h"
+#include "Clock_Counter_RG.h"
+#include "../source/bsw/swtimer.c"
+
+/*****************************************************************************/
+/* Time base and Counter model                                               */
+/*****************************************************************************/
+
+#define TEST__CYCLES_MS     24000u      /**< BCLK 24 MHz */
+#define TEST__COUNT         (BCLK__BUS_CLK__HZ / SWTIMER_COUNTER_HZ)
+#define TEST__LATENCY       500u        /**< Interrupt entry to SWTIMER_Expire() [cycles] */
+#define TEST__FIRES         256u        /**< Expiries a test can note */
+
+static TIMEBASE_time_t TEST__now = 0;
+static boolean_t TEST__running = FALSE;
+static uint16 TEST__counts = 0;
+static TIMEBASE_time_t TEST__zero = 0;     /**< Time the running Counter reaches zero */
+static uint8_t TEST__suspended = 0;
+
+/** Expiries in the order the callbacks ran */
+static struct {
+    TIMEBASE_time_t time[TEST__FIRES];
+    uintptr_t id[TEST__FIRES];
+    uint16_t count;
+} TEST__fired;
+
+TIMEBASE_time_t TIMEBASE_Now(void)
+{
+    return TEST__now;
+}
+
+void Clock_Counter_RG_Start(void)
+{
+}
+
+void Counter_Start(void)
+{
+    TEST__running = TRUE;
+    TEST__zero = TEST__now + (TIMEBASE_time_t)TEST__counts * TEST__COUNT;
+}
+
+void Counter_Stop(void)
+{
+    TEST__running = FALSE;
+}
+
+void Counter_WriteCounter(uint16 counter)
+{
+    TEST__counts = counter;
+}
+
+void SuspendAllInterrupts(void)
+{
+    TEST__suspended++;
+}
+
+void ResumeAllInterrupts(void)
+{
+    TEST__suspended--;
+}
+
+static void TEST__callback(void* context)
+{
+    UNIT_CHECK(TEST__suspended == 0);
+    if (TEST__fired.count < TEST__FIRES)
+    {
+        TEST__fired.time[TEST__fired.count] = TEST__now;
+        TEST__fired.id[TEST__fired.count] = (uintptr_t)context;
+        TEST__fired.count++;
+    }
+}
+
+/** Lets the time pass for ms, running isr_timer whenever the Counter reaches zero */
+static void TEST__run(uint32_t ms, uint32_t latency)
+{
+    TIMEBASE_time_t const end = TEST__now + (TIMEBASE_time_t)ms * TEST__CYCLES_MS;
+
+    while ((TEST__running == TRUE) && (TEST__zero <= end))
+    {
+        TEST__now = TEST__zero + latency;
+        TEST__running = FALSE;
+        UNIT_CHECK(SWTIMER_Expire(NULL) == RC_SUCCESS);
+    }
+    TEST__now = (TEST__now > end) ? TEST__now : end;
+}
+
+static void TEST__reset(void)
+{
+    TEST__fired.count = 0;
+    UNIT_CHECK(SWTIMER_Init() == RC_SUCCESS);
+    UNIT_CHECK(TEST__running == FALSE);
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__params(void)
+{
+    SWTIMER_t timer;
+    uint16_t lost = 0xFFFF;
+    uint8_t expired = 0xFF;
+
+    TEST__reset();
+    UNIT_CHECK(SWTIMER_Create(NULL, TEST__callback, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(SWTIMER_Create(&timer, NULL, NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(SWTIMER_Create(&timer, TEST__callback, NULL) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Start(NULL, 1, 0) == RC_ERROR_NULL);
+    UNIT_CHECK(SWTIMER_Cancel(NULL) == RC_ERROR_NULL);
+    UNIT_CHECK(SWTIMER_GetLost(NULL) == RC_ERROR_NULL);
+
+    /* Nothing pending: no callback, the Counter stays stopped */
+    UNIT_CHECK(SWTIMER_Expire(&expired) == RC_SUCCESS);
+    UNIT_CHECK(expired == 0);
+    UNIT_CHECK(TEST__running == FALSE);
+    UNIT_CHECK((SWTIMER_GetLost(&lost) == RC_SUCCESS) && (lost == 0));
+    UNIT_CHECK(TEST__suspended == 0);
+}
+
+static void TEST__order(void)
+{
+    static const uint32_t delays[] = {30, 10, 20, 0, 10, 5};
+    static SWTIMER_t timers[sizeof(delays) / sizeof(delays[0])];
+    static const uintptr_t expected[] = {3, 5, 1, 4, 2, 0};
+    TIMEBASE_time_t const start = TEST__now;
+    boolean_t onTime = TRUE;
+
+    TEST__reset();
+    for (uintptr_t i = 0; i < sizeof(delays) / sizeof(delays[0]); ++i)
+    {
+        UNIT_CHECK(SWTIMER_Create(&timers[i], TEST__callback, (void*)i) == RC_SUCCESS);
+        UNIT_CHECK(SWTIMER_Start(&timers[i], delays[i], 0) == RC_SUCCESS);
+    }
+    TEST__run(100, 0);
+
+    /* Earliest first, equal delays in any order, never early and at most one count late */
+    UNIT_CHECK(TEST__fired.count == sizeof(delays) / sizeof(delays[0]));
+    for (uint16_t i = 0; i < TEST__fired.count; ++i)
+    {
+        uintptr_t const id = TEST__fired.id[i];
+        TIMEBASE_time_t const due = start + (TIMEBASE_time_t)delays[id] * TEST__CYCLES_MS;
+
+        onTime = ((TEST__fired.time[i] >= due) && (TEST__fired.time[i] <= due + TEST__COUNT)) ? onTime : FALSE;
+        onTime = (delays[id] == delays[expected[i]]) ? onTime : FALSE;
+        onTime = (timers[id].active == FALSE) ? onTime : FALSE;
+    }
+    UNIT_CHECK(onTime == TRUE);
+    UNIT_CHECK(TEST__running == FALSE);
+}
+
+static void TEST__cancel(void)
+{
+    SWTIMER_t cancelled;
+    SWTIMER_t restarted;
+    TIMEBASE_time_t start;
+
+    TEST__reset();
+    UNIT_CHECK(SWTIMER_Create(&cancelled, TEST__callback, (void*)1) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Create(&restarted, TEST__callback, (void*)2) == RC_SUCCESS);
+
+    /* A cancelled timer never expires */
+    UNIT_CHECK(SWTIMER_Start(&cancelled, 10, 5) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Cancel(&cancelled) == RC_SUCCESS);
+    UNIT_CHECK(cancelled.active == FALSE);
+    TEST__run(50, 0);
+    UNIT_CHECK(TEST__fired.count == 0);
+    UNIT_CHECK(TEST__running == FALSE);
+
+    /* A restarted timer expires once, for the last start */
+    start = TEST__now;
+    UNIT_CHECK(SWTIMER_Start(&restarted, 10, 0) == RC_SUCCESS);
+    TEST__run(5, 0);
+    UNIT_CHECK(SWTIMER_Start(&restarted, 40, 0) == RC_SUCCESS);
+    TEST__run(100, 0);
+    UNIT_CHECK(TEST__fired.count == 1);
+    UNIT_CHECK(TEST__fired.id[0] == 2);
+    UNIT_CHECK(TEST__fired.time[0] >= start + 45u * TEST__CYCLES_MS);
+    UNIT_CHECK(TEST__fired.time[0] <= start + 45u * TEST__CYCLES_MS + TEST__COUNT);
+}
+
+static void TEST__periodic(void)
+{
+    SWTIMER_t timer;
+    TIMEBASE_time_t const start = TEST__now;
+    uint32_t const period = 7;
+    boolean_t onTime = TRUE;
+
+    /* Every expiry is served late, the next one is still due from the previous due time */
+    TEST__reset();
+    UNIT_CHECK(SWTIMER_Create(&timer, TEST__callback, NULL) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Start(&timer, period, period) == RC_SUCCESS);
+    TEST__run(1000, TEST__LATENCY);
+
+    UNIT_CHECK(TEST__fired.count == 1000 / period);
+    for (uint16_t i = 0; i < TEST__fired.count; ++i)
+    {
+        TIMEBASE_time_t const due = start + (TIMEBASE_time_t)(i + 1u) * period * TEST__CYCLES_MS;
+        onTime = ((TEST__fired.time[i] >= due) && (TEST__fired.time[i] <= due + TEST__COUNT + TEST__LATENCY)) ? onTime : FALSE;
+    }
+    UNIT_CHECK(onTime == TRUE);
+    UNIT_CHECK(timer.active == TRUE);
+    UNIT_CHECK(SWTIMER_Cancel(&timer) == RC_SUCCESS);
+}
+
+static void TEST__longDelay(void)
+{
+    SWTIMER_t timer;
+    TIMEBASE_time_t const start = TEST__now;
+
+    /* 10 s are longer than the 5.4 s of the Counter: one empty shot first */
+    TEST__reset();
+    UNIT_CHECK(SWTIMER_Create(&timer, TEST__callback, NULL) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Start(&timer, 10000, 0) == RC_SUCCESS);
+    UNIT_CHECK((TEST__running == TRUE) && (TEST__counts == SWTIMER_MAX_COUNTS));
+    TEST__run(6000, 0);
+    UNIT_CHECK(TEST__fired.count == 0);
+    UNIT_CHECK((TEST__running == TRUE) && (TEST__counts < SWTIMER_MAX_COUNTS));
+    TEST__run(5000, 0);
+    UNIT_CHECK(TEST__fired.count == 1);
+    UNIT_CHECK(TEST__fired.time[0] >= start + 10000u * TEST__CYCLES_MS);
+    UNIT_CHECK(TEST__fired.time[0] <= start + 10000u * TEST__CYCLES_MS + TEST__COUNT);
+}
+
+static void TEST__full(void)
+{
+    static SWTIMER_t timers[SWTIMER_HEAP_SIZE + 1];
+    uint16_t lost = 0xFFFF;
+
+    TEST__reset();
+    for (uint8_t i = 0; i < SWTIMER_HEAP_SIZE + 1; ++i)
+    {
+        UNIT_CHECK(SWTIMER_Create(&timers[i], TEST__callback, NULL) == RC_SUCCESS);
+    }
+    for (uint8_t i = 0; i < SWTIMER_HEAP_SIZE; ++i)
+    {
+        UNIT_CHECK(SWTIMER_Start(&timers[i], 10u + i, 10) == RC_SUCCESS);
+    }
+
+    /* Only pending timers in the heap, the start is refused */
+    UNIT_CHECK(SWTIMER_Start(&timers[SWTIMER_HEAP_SIZE], 1, 0) == RC_ERROR_BUFFER_FULL);
+    UNIT_CHECK(timers[SWTIMER_HEAP_SIZE].active == FALSE);
+
+    /* A cancelled entry is dropped to make room */
+    UNIT_CHECK(SWTIMER_Cancel(&timers[0]) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Start(&timers[SWTIMER_HEAP_SIZE], 1, 0) == RC_SUCCESS);
+
+    /* A full heap of periodic timers keeps all of them running */
+    TEST__run(200, TEST__LATENCY);
+    UNIT_CHECK(TEST__fired.count == TEST__FIRES);
+    for (uint8_t i = 1; i < SWTIMER_HEAP_SIZE; ++i)
+    {
+        UNIT_CHECK(timers[i].active == TRUE);
+        UNIT_CHECK(SWTIMER_Cancel(&timers[i]) == RC_SUCCESS);
+    }
+    UNIT_CHECK((SWTIMER_GetLost(&lost) == RC_SUCCESS) && (lost == 0));
+}
+
+static void TEST__generation(void)
+{
+    SWTIMER_t timer;
+    TIMEBASE_time_t const start = TEST__now;
+
+    /* The entry of the first start is older by 256 generations */
+    TEST__reset();
+    UNIT_CHECK(SWTIMER_Create(&timer, TEST__callback, NULL) == RC_SUCCESS);
+    UNIT_CHECK(SWTIMER_Start(&timer, 100, 0) == RC_SUCCESS);
+    for (uint16_t i = 0; i < 255; ++i)
+    {
+        UNIT_CHECK(SWTIMER_Cancel(&timer) == RC_SUCCESS);
+    }
+    UNIT_CHECK(SWTIMER_Start(&timer, 1000, 0) == RC_SUCCESS);
+
+    TEST__run(500, 0);
+    UNIT_CHECK(TEST__fired.count == 0);
+    TEST__run(1000, 0);
+    UNIT_CHECK(TEST__fired.count == 1);
+    UNIT_CHECK(TEST__fired.time[0] >= start + 1000u * TEST__CYCLES_MS);
+}
+
+int main(void)
+{
+    TEST__params();
+    TEST__order();
+    TEST__cancel();
+    TEST__periodic();
+    TEST__longDelay();
+    TEST__full();
+    TEST__generation();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,117 @@
+/**
+* \file test_timebase.c
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Host test of the 64 bit time base across wraps of the cycle counter
+*
+* The simulated cycle counter is stepped through several of its 32 bit wraps,
+* in steps of 1 ms and of almost a whole wrap. The time read back has to be
+* the sum of the steps, TIMEBASE_Now32() its low word. While the CPU clock is
+* divided every cycle has to count with the divider, the cycles before a
+* change with the old one.
+*/
+
+#include "unit.h"
+#include "project.h"
+#include "cycle.h"
+#include "../source/bsw/timebase.c"
+
+/*****************************************************************************/
+/* DWT and critical section model                                            */
+/*****************************************************************************/
+
+#define TEST__CYCLES_MS     24000u      /**< BCLK 24 MHz */
+#define TEST__WRAPS         5u          /**< Wraps of the cycle counter per test */
+
+uint32_t CYCLE_hostNow = 0xFFFF0000u;   /**< Wraps on the first millisecond steps */
+
+static uint8 TEST__nesting = 0;
+
+RC_t CYCLE_Init(void)
+{
+    return RC_SUCCESS;
+}
+
+uint8 CyEnterCriticalSection(void)
+{
+    return TEST__nesting++;
+}
+
+void CyExitCriticalSection(uint8 savedIntrStatus)
+{
+    TEST__nesting = savedIntrStatus;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void TEST__wrap(void)
+{
+    TIMEBASE_time_t expected = 0;
+    boolean_t same = TRUE;
+
+    UNIT_CHECK(TIMEBASE_Init() == RC_SUCCESS);
+    UNIT_CHECK(TIMEBASE_Now() == 0);
+    UNIT_CHECK(TIMEBASE_Now32() == 0);
+
+    /* 1 ms ticks as systick_handler does them */
+    for (uint32_t tick = 0; tick < TEST__WRAPS * (0xFFFFFFFFu / TEST__CYCLES_MS); ++tick)
+    {
+        CYCLE_hostNow += TEST__CYCLES_MS;
+        expected += TEST__CYCLES_MS;
+        (void)TIMEBASE_Tick();
+        same = (TIMEBASE_Now32() == (uint32_t)expected) ? same : FALSE;
+    }
+    UNIT_CHECK(same == TRUE);
+    UNIT_CHECK(TIMEBASE_Now() == expected);
+    UNIT_CHECK(expected > (TIMEBASE_time_t)TEST__WRAPS * 0xFF000000u);
+
+    /* Reads almost a wrap apart, the longest gap the accumulation survives */
+    for (uint8_t i = 0; i < TEST__WRAPS; ++i)
+    {
+        CYCLE_hostNow += 0xFFFFFFFFu;
+        expected += 0xFFFFFFFFu;
+        UNIT_CHECK(TIMEBASE_Now32() == (uint32_t)expected);
+        UNIT_CHECK(TIMEBASE_Now() == expected);
+    }
+
+    /* Monotonic and no critical section left open */
+    UNIT_CHECK(TIMEBASE_Now() == expected);
+    UNIT_CHECK(TEST__nesting == 0);
+}
+
+static void TEST__divider(void)
+{
+    UNIT_CHECK(TIMEBASE_SetCpuDivider(0) == RC_ERROR_BAD_PARAM);
+
+    UNIT_CHECK(TIMEBASE_Init() == RC_SUCCESS);
+    CYCLE_hostNow += 1000u;
+
+    /* The cycles before the change count once, the following four times */
+    UNIT_CHECK(TIMEBASE_SetCpuDivider(4) == RC_SUCCESS);
+    UNIT_CHECK(TIMEBASE_Now() == 1000u);
+    CYCLE_hostNow += 1000u;
+    UNIT_CHECK(TIMEBASE_Now32() == 5000u);
+    UNIT_CHECK(TIMEBASE_Now() == 5000u);
+
+    /* A divided clock across a wrap of the cycle counter */
+    CYCLE_hostNow += 0xFFFFFF00u;
+    UNIT_CHECK(TIMEBASE_Now() == 5000u + 4u * (TIMEBASE_time_t)0xFFFFFF00u);
+    UNIT_CHECK(TIMEBASE_Now32() == (uint32_t)(5000u + 4u * (TIMEBASE_time_t)0xFFFFFF00u));
+
+    /* Back at full speed */
+    UNIT_CHECK(TIMEBASE_SetCpuDivider(1) == RC_SUCCESS);
+    CYCLE_hostNow += 24u;
+    UNIT_CHECK(TIMEBASE_Now() == 5024u + 4u * (TIMEBASE_time_t)0xFFFFFF00u);
+    UNIT_CHECK(TEST__nesting == 0);
+}
+
+int main(void)
+{
+    TEST__wrap();
+    TEST__divider();
+
+    return UNIT_RESULT();
+}
@@ -0,0 +1,45 @@
+/**
+* \file unit.h
+* \author Z. Sadique
+* \date 18.10.2026
+*
+* \brief Minimal check macros for the host module tests
+*
+* A test includes the module source it tests, so static data and functions
+* are reachable, and reports through UNIT_CHECK() and UNIT_RESULT().
+* Host benchmarks take their time from UNIT_Nanoseconds().
+*/
+
+#ifndef UNIT_H
+#define UNIT_H
+
+#include <stdio.h>
+#include <time.h>
+
+static unsigned int UNIT__checks;   /**< Checks executed */
+static unsigned int UNIT__failed;   /**< Checks failed */
+
+/** Counts a check and prints the location of a failing one */
+#define UNIT_CHECK(cond)                                                    \
+    do {                                                                    \
+        ++UNIT__checks;                                                     \
+        if (!(cond)) {                                                      \
+            ++UNIT__failed;                                                 \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                   \
+    } while (0)
+
+/** Prints the summary of the test, to be returned from main() */
+#define UNIT_RESULT()                                                       \
+    (printf("%s: %u checks, %u failed\n", __FILE__, UNIT__checks, UNIT__failed), \
+     (UNIT__failed == 0U) ? 0 : 1)
+
+/** Monotonic host time for the benchmarks [ns] */
+static inline unsigned long long UNIT_Nanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+#endif /* UNIT_H */